@@ -1,11 +1,34 @@
 #include "Adafruit_SSD1306.h"
 #include "splash.h"
 #include "Adafruit_GFX.h"
+#include "Adafruit_SSD1306_GlyphCache.h"
+#include "esp_timer.h"
 
 
 #define ssd1306_swap(a, b)                                                     \
   (((a) ^= (b)), ((b) ^= (a)), ((a) ^= (b))) ///< No-temp-var swap operation
 
+/*!
+    @brief  Transpose an 8x8 bit matrix packed into 64 bits, one byte per
+            row, most significant byte first, bit 7 of each byte in column
+            0 (Hacker's Delight, transpose8).
+    @param  x
+            Matrix to transpose.
+    @return Transposed matrix, same packing.
+*/
+static inline uint64_t ssd1306_transpose8x8(uint64_t x)
+{
+    uint64_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+    x = x ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+    x = x ^ t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+    x = x ^ t ^ (t << 28);
+    return x;
+}
+
 /*!
  * @file Adafruit_SSD1306.cpp
  *
@@ -58,9 +81,16 @@
     @note   Call the object's begin() function before use -- buffer
             allocation is performed there!
 */
-Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, i2c_port_t port) : Adafruit_GFX(w, h), buffer(NULL)
+Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, i2c_port_t port) : Adafruit_GFX(w, h), buffer(NULL), mux(NULL), muxChannel(0),
+    transport(NULL), transportContext(NULL), mirror(NULL), mirrorContext(NULL),
+    drawLock(NULL), busLock(NULL), ownBusLock(false), txBuffer(NULL), drawDepth(0), busDepth(0),
+    glyphCache(NULL)
 {
     i2c = port;
+    memset(dirtyX1, 0xFF, sizeof(dirtyX1));
+    memset(dirtyX2, 0, sizeof(dirtyX2));
+    resetLockStats();
+    resetStats();
 }
 
 /*!
@@ -72,6 +102,16 @@ Adafruit_SSD1306::~Adafruit_SSD1306(void)
         free(buffer);
         buffer = NULL;
     }
+    if (txBuffer) {
+        free(txBuffer);
+        txBuffer = NULL;
+    }
+    if (drawLock) {
+        vSemaphoreDelete(drawLock);
+    }
+    if (busLock && ownBusLock) {
+        vSemaphoreDelete(busLock);
+    }
 }
 
 
@@ -88,6 +128,10 @@ Adafruit_SSD1306::~Adafruit_SSD1306(void)
 */
 bool Adafruit_SSD1306::begin(int8_t addr)
 {
+    if (((HEIGHT + 7) / 8) > SSD1306_MAX_PAGES) {
+        return false;
+    }
+
     if ((!buffer) && !(buffer = (uint8_t *)malloc(WIDTH * ((HEIGHT + 7) / 8)))) {
         return false;
     }
@@ -98,16 +142,17 @@ bool Adafruit_SSD1306::begin(int8_t addr)
 
 #ifndef SSD1306_NO_SPLASH
     if (HEIGHT > 32) {
-        drawBitmap((WIDTH - splash1_width) / 2, (HEIGHT - splash1_height) / 2,
-                splash1_data, splash1_width, splash1_height, 1);
+        drawPageBitmap((WIDTH - splash1_width) / 2, (HEIGHT - splash1_height) / 2,
+                splash1_pages, splash1_width, splash1_height, 1, 0);
     }
     else {
-        drawBitmap((WIDTH - splash2_width) / 2, (HEIGHT - splash2_height) / 2,
-                splash2_data, splash2_width, splash2_height, 1);
+        drawPageBitmap((WIDTH - splash2_width) / 2, (HEIGHT - splash2_height) / 2,
+                splash2_pages, splash2_width, splash2_height, 1, 0);
     }
 #endif
 
     // Init sequence
+    ssd1306_lockBus();
     static const uint8_t init1[] = {
         SSD1306_DISPLAYOFF,         // 0xAE
         SSD1306_SETDISPLAYCLOCKDIV, // 0xD5
@@ -168,10 +213,43 @@ bool Adafruit_SSD1306::begin(int8_t addr)
         SSD1306_DEACTIVATE_SCROLL,
         SSD1306_DISPLAYON};             // Main screen turn on
     ssd1306_commandList(init5, sizeof(init5));
+    ssd1306_unlockBus();
 
     return (true);
 }
 
+/*!
+    @brief  Reach the display through a TCA9548A multiplexer channel.
+    @param  mux
+            Multiplexer shared by the displays behind it, or NULL for a
+            display connected to the bus directly.
+    @param  channel
+            Multiplexer channel the display is connected to, 0 to 7.
+    @return None (void).
+    @note   Call before begin() and enableLocking(). The channel is
+            selected before every transfer, and skipped when it is already
+            the current one, so updating one display completely before the
+            next -- e.g. displayDirty() on each in turn -- keeps selects to
+            a minimum. Displays behind one multiplexer used from several
+            tasks must all call enableLocking(): they then share the
+            multiplexer's lock, which also guards its cached channel.
+*/
+void Adafruit_SSD1306::setMux(Adafruit_SSD1306_Mux *mux, uint8_t channel)
+{
+    this->mux = mux;
+    muxChannel = channel;
+}
+
+/*!
+    @brief  Get the multiplexer set with setMux().
+    @return Multiplexer in front of the display, or NULL if the display is
+            connected to the bus directly.
+*/
+Adafruit_SSD1306_Mux *Adafruit_SSD1306::getMux(void)
+{
+    return mux;
+}
+
 /*!
     @brief Issue single command to SSD1306
    Because command calls are often grouped, SPI transaction and
@@ -185,16 +263,7 @@ bool Adafruit_SSD1306::begin(int8_t addr)
 */
 void Adafruit_SSD1306::ssd1306_command1(uint8_t c)
 {
-	i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    if(cmd != NULL) {
-        i2c_master_start(cmd);
-        i2c_master_write_byte(cmd, (i2caddr << 1) | I2C_MASTER_WRITE, true);
-        i2c_master_write_byte(cmd, SSD1306_CONTROL_BYTE_CMD_STREAM, true);
-        i2c_master_write_byte(cmd, c, true);
-        i2c_master_stop(cmd);
-        ESP_ERROR_CHECK_WITHOUT_ABORT(i2c_master_cmd_begin(i2c, cmd, 10/portTICK_PERIOD_MS));
-        i2c_cmd_link_delete(cmd);
-    }
+    ssd1306_transfer(SSD1306_CONTROL_BYTE_CMD_STREAM, &c, 1);
 }
 
 /*!
@@ -208,21 +277,442 @@ void Adafruit_SSD1306::ssd1306_command1(uint8_t c)
     @note
 */
 void Adafruit_SSD1306::ssd1306_commandList(const uint8_t *c, uint8_t n) {
+    ssd1306_transfer(SSD1306_CONTROL_BYTE_CMD_STREAM, c, n);
+}
+
+/*!
+    @brief Send one I2C transaction to the SSD1306. Every command and data
+   byte leaves the library through here. This is a protected function, not
+   exposed.
+        @param control
+                   control byte sent after the address, one of the
+                   SSD1306_CONTROL_BYTE_* values
+        @param data
+                   first byte to send
+        @param len
+                   number of consecutive bytes to send per row
+        @param rows
+                   number of rows of len bytes, used to send a rectangle of
+                   the buffer in a single transaction
+        @param stride
+                   distance in bytes between the start of consecutive rows
+    @return true if the transaction was acknowledged, false otherwise.
+*/
+bool Adafruit_SSD1306::ssd1306_transfer(uint8_t control, const uint8_t *data,
+                                        uint16_t len, uint8_t rows,
+                                        uint16_t stride)
+{
+    esp_err_t err = ESP_OK;
+
+    ssd1306_lockBus();
+    if (transport) {
+        if (!transport(transportContext, control, data, len, rows, stride)) {
+            err = ESP_FAIL;
+        }
+    }
+    else {
+        err = ssd1306_i2cWrite(control, data, len, rows, stride);
+    }
+
+#ifndef SSD1306_NO_STATS
+    uint32_t payload = (uint32_t)len * rows;
+    stats.transactions++;
+    stats.bytes += payload + 2;
+    if (control == SSD1306_CONTROL_BYTE_DATA_STREAM) {
+        stats.dataBytes += payload;
+    }
+    else {
+        stats.commandBytes += payload;
+    }
+#endif
+    if (err != ESP_OK) {
+        ssd1306_countError(err);
+    }
+    ssd1306_unlockBus();
+
+    return (err == ESP_OK);
+}
+
+/*!
+    @brief Send one transaction on the I2C port, selecting the multiplexer
+   channel first if needed. Arguments as for ssd1306_transfer(). This is a
+   protected function, not exposed.
+    @return ESP_OK, or the error of the failing I2C operation.
+*/
+esp_err_t Adafruit_SSD1306::ssd1306_i2cWrite(uint8_t control, const uint8_t *data,
+                                             uint16_t len, uint8_t rows,
+                                             uint16_t stride)
+{
+    if (mux) {
+        bool selected = false;
+        esp_err_t err = mux->select(muxChannel, &selected);
+#ifndef SSD1306_NO_STATS
+        if (selected) {
+            // Address and channel byte to the TCA9548A
+            stats.transactions++;
+            stats.bytes += 2;
+            stats.links++;
+        }
+#endif
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
 
     i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    if(cmd != NULL) {
-        i2c_master_start(cmd);
-        i2c_master_write_byte(cmd, (i2caddr << 1) | I2C_MASTER_WRITE, true);
-        i2c_master_write_byte(cmd, SSD1306_CONTROL_BYTE_CMD_STREAM, true);
-        while (n--) { i2c_master_write_byte(cmd, *c++, true); }
-        i2c_master_stop(cmd);
-        ESP_ERROR_CHECK_WITHOUT_ABORT(i2c_master_cmd_begin(i2c, cmd, 10/portTICK_PERIOD_MS));
-        i2c_cmd_link_delete(cmd);
+#ifndef SSD1306_NO_STATS
+    stats.links++;
+#endif
+    if (cmd == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    i2c_master_start(cmd);
+    i2c_master_write_byte(cmd, (i2caddr << 1) | I2C_MASTER_WRITE, true);
+    i2c_master_write_byte(cmd, control, true);
+    for (uint8_t i = 0; i < rows; i++) {
+        i2c_master_write(cmd, data + i * stride, len, true);
+    }
+    i2c_master_stop(cmd);
+    esp_err_t err = ESP_ERROR_CHECK_WITHOUT_ABORT(i2c_master_cmd_begin(i2c, cmd, 10/portTICK_PERIOD_MS));
+    i2c_cmd_link_delete(cmd);
+
+    return err;
+}
+
+/*!
+    @brief  Send all traffic to a callback instead of the I2C port, e.g.
+            Adafruit_SSD1306_Emulator::transport for host builds and tests.
+    @param  transport
+            Function receiving each transaction, or NULL to use I2C again.
+    @param  context
+            Passed unchanged to the function.
+    @return None (void).
+*/
+void Adafruit_SSD1306::setTransport(ssd1306_transport_t transport, void *context)
+{
+    this->transport = transport;
+    transportContext = context;
+}
+
+/*!
+    @brief  Receive a copy of every area sent to the display, e.g. to
+            mirror the screen live to a host tool over a debug link.
+    @param  mirror
+            Function called for each page span as it is sent, and with a
+            zero length record at the end of each update; NULL to stop.
+    @param  context
+            Passed unchanged to the function.
+    @return None (void).
+    @note   With displayDirty() only the changed spans are reported, so the
+            link carries a few bytes per small change instead of whole
+            frames; the host applies the spans to its own copy of the
+            buffer. Call display() once after setting the mirror to give
+            the host a complete first frame. The function runs in the
+            updating task with the bus locked and should only queue data.
+*/
+void Adafruit_SSD1306::setMirror(ssd1306_mirror_t mirror, void *context)
+{
+    this->mirror = mirror;
+    mirrorContext = context;
+}
+
+/*!
+    @brief  Tell the mirror an update is complete. This is a protected
+            function, not exposed.
+    @return None (void).
+*/
+void Adafruit_SSD1306::ssd1306_mirrorEnd(void)
+{
+    if (mirror) {
+        mirror(mirrorContext, 0, 0, 0, NULL);
+    }
+}
+
+// STATISTICS --------------------------------------------------------------
+
+/*!
+    @brief  Get the transfer counters.
+    @return Pointer to the counters of this display, updated in place.
+    @note   All zero if the library is built with SSD1306_NO_STATS.
+*/
+const ssd1306_stats_t *Adafruit_SSD1306::getStats(void)
+{
+    return &stats;
+}
+
+/*!
+    @brief  Zero the transfer counters.
+    @return None (void).
+*/
+void Adafruit_SSD1306::resetStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+/*!
+    @brief  Count a failed transaction under its error code. This is a
+            protected function, not exposed.
+    @param  err
+            Error returned for the transaction.
+    @return None (void).
+*/
+void Adafruit_SSD1306::ssd1306_countError(esp_err_t err)
+{
+#ifndef SSD1306_NO_STATS
+    stats.failures++;
+    for (uint8_t i = 0; i < SSD1306_STATS_ERRORS; i++) {
+        if ((stats.errors[i] == err) || (stats.errorCounts[i] == 0)) {
+            stats.errors[i] = err;
+            stats.errorCounts[i]++;
+            return;
+        }
+    }
+#endif
+}
+
+/*!
+    @brief  Record the duration of a display update. This is a protected
+            function, not exposed.
+    @param  since
+            esp_timer_get_time() at the start of the update.
+    @return None (void).
+*/
+void Adafruit_SSD1306::ssd1306_countDisplay(int64_t since)
+{
+#ifndef SSD1306_NO_STATS
+    stats.displays++;
+    stats.lastDisplayUs = (uint32_t)(esp_timer_get_time() - since);
+    if (stats.lastDisplayUs > stats.maxDisplayUs) {
+        stats.maxDisplayUs = stats.lastDisplayUs;
+    }
+#endif
+}
+
+// LOCKING -----------------------------------------------------------------
+
+/*!
+    @brief  Make the display object safe to use from several FreeRTOS
+            tasks.
+    @param  busMutex
+            Recursive mutex (xSemaphoreCreateRecursiveMutex()) shared with
+            other displays on the same bus, or NULL to create one for this
+            display only. Ignored behind a multiplexer, whose own lock
+            (Adafruit_SSD1306_Mux::getLock()) is used instead.
+    @return true on success, false if a lock or the transfer snapshot
+            buffer could not be allocated.
+    @note   Two locks are used. The bus lock keeps command and data
+            sequences of different tasks from interleaving. The draw lock
+            is taken by startWrite()/endWrite(), which Adafruit_GFX calls
+            around every primitive, and by display() only while it copies
+            the area to send -- the transfer itself runs unlocked, so other
+            tasks keep drawing meanwhile. Code calling drawPixel() directly
+            or writing to getBuffer() from several tasks must bracket it
+            with startWrite()/endWrite() itself.
+*/
+bool Adafruit_SSD1306::enableLocking(SemaphoreHandle_t busMutex)
+{
+    if (drawLock) {
+        return true;
+    }
+    if (!(txBuffer = (uint8_t *)malloc(WIDTH * ((HEIGHT + 7) / 8)))) {
+        return false;
+    }
+    if (!(drawLock = xSemaphoreCreateRecursiveMutex())) {
+        free(txBuffer);
+        txBuffer = NULL;
+        return false;
+    }
+    if (mux) {
+        busLock = mux->getLock();
+        ownBusLock = false;
+    }
+    else {
+        busLock = busMutex ? busMutex : xSemaphoreCreateRecursiveMutex();
+        ownBusLock = (busMutex == NULL);
+    }
+    if (!busLock) {
+        vSemaphoreDelete(drawLock);
+        drawLock = NULL;
+        free(txBuffer);
+        txBuffer = NULL;
+        return false;
+    }
+    return true;
+}
+
+/*!
+    @brief  Take a recursive lock, recording wait time and contention.
+    @param  lock
+            Lock to take.
+    @param  stats
+            Usage counters of that lock.
+    @return Time the lock was acquired, in microseconds.
+*/
+static int64_t ssd1306_take(SemaphoreHandle_t lock, ssd1306_lock_stats_t *stats)
+{
+    if (xSemaphoreTakeRecursive(lock, 0) != pdTRUE) {
+        int64_t t0 = esp_timer_get_time();
+        xSemaphoreTakeRecursive(lock, portMAX_DELAY);
+        uint32_t wait = (uint32_t)(esp_timer_get_time() - t0);
+        stats->contended++;
+        if (wait > stats->maxWaitUs) {
+            stats->maxWaitUs = wait;
+        }
     }
+    stats->count++;
+    return esp_timer_get_time();
+}
+
+/*!
+    @brief  Release a recursive lock, recording how long it was held.
+    @param  lock
+            Lock to release.
+    @param  stats
+            Usage counters of that lock.
+    @param  since
+            Time the lock was acquired.
+    @return None (void).
+*/
+static void ssd1306_give(SemaphoreHandle_t lock, ssd1306_lock_stats_t *stats, int64_t since)
+{
+    uint32_t hold = (uint32_t)(esp_timer_get_time() - since);
+    stats->totalHoldUs += hold;
+    if (hold > stats->maxHoldUs) {
+        stats->maxHoldUs = hold;
+    }
+    xSemaphoreGiveRecursive(lock);
+}
+
+/*!
+    @brief  Take the draw lock, if locking is enabled. Called by
+            Adafruit_GFX around each drawing primitive; may be nested.
+    @return None (void).
+*/
+void Adafruit_SSD1306::startWrite(void)
+{
+    if (!drawLock) {
+        return;
+    }
+    if (drawDepth && (xSemaphoreGetMutexHolder(drawLock) == xTaskGetCurrentTaskHandle())) {
+        xSemaphoreTakeRecursive(drawLock, portMAX_DELAY);
+        drawDepth++;
+        return;
+    }
+    drawSince = ssd1306_take(drawLock, &drawStats);
+    drawDepth = 1;
+}
+
+/*!
+    @brief  Release the draw lock taken by startWrite().
+    @return None (void).
+*/
+void Adafruit_SSD1306::endWrite(void)
+{
+    if (!drawLock) {
+        return;
+    }
+    if (--drawDepth) {
+        xSemaphoreGiveRecursive(drawLock);
+        return;
+    }
+    ssd1306_give(drawLock, &drawStats, drawSince);
+}
+
+/*!
+    @brief  Take the bus lock around a command/data sequence that must not
+            be interleaved with another task's. This is a protected
+            function, not exposed.
+    @return None (void).
+*/
+void Adafruit_SSD1306::ssd1306_lockBus(void)
+{
+    if (!busLock) {
+        return;
+    }
+    if (busDepth && (xSemaphoreGetMutexHolder(busLock) == xTaskGetCurrentTaskHandle())) {
+        xSemaphoreTakeRecursive(busLock, portMAX_DELAY);
+        busDepth++;
+        return;
+    }
+    busSince = ssd1306_take(busLock, &busStats);
+    busDepth = 1;
+}
+
+/*!
+    @brief  Release the bus lock taken by ssd1306_lockBus(). This is a
+            protected function, not exposed.
+    @return None (void).
+*/
+void Adafruit_SSD1306::ssd1306_unlockBus(void)
+{
+    if (!busLock) {
+        return;
+    }
+    if (--busDepth) {
+        xSemaphoreGiveRecursive(busLock);
+        return;
+    }
+    ssd1306_give(busLock, &busStats, busSince);
+}
+
+/*!
+    @brief  Get the lock usage counters.
+    @param  draw
+            Receives the draw lock counters, may be NULL.
+    @param  bus
+            Receives the bus lock counters, may be NULL.
+    @return None (void).
+    @note   With a bus mutex shared between displays, the bus counters
+            only cover the transfers made by this display.
+*/
+void Adafruit_SSD1306::getLockStats(ssd1306_lock_stats_t *draw, ssd1306_lock_stats_t *bus)
+{
+    if (draw) {
+        *draw = drawStats;
+    }
+    if (bus) {
+        *bus = busStats;
+    }
+}
+
+/*!
+    @brief  Zero the lock usage counters.
+    @return None (void).
+*/
+void Adafruit_SSD1306::resetLockStats(void)
+{
+    memset(&drawStats, 0, sizeof(drawStats));
+    memset(&busStats, 0, sizeof(busStats));
 }
 
 // DRAWING FUNCTIONS -------------------------------------------------------
 
+/*!
+    @brief  Apply a color to some bits of a buffer byte.
+    @param  dst
+            Buffer byte.
+    @param  bits
+            Bits (pixels) to change.
+    @param  color
+            SSD1306_WHITE, SSD1306_BLACK or SSD1306_INVERSE.
+    @return None (void).
+*/
+static inline void ssd1306_apply(uint8_t *dst, uint8_t bits, uint16_t color)
+{
+    switch (color) {
+    case SSD1306_WHITE:
+        *dst |= bits;
+        break;
+    case SSD1306_BLACK:
+        *dst &= ~bits;
+        break;
+    case SSD1306_INVERSE:
+        *dst ^= bits;
+        break;
+    }
+}
+
 /*!
     @brief  Set/clear/invert a single pixel. This is also invoked by the
             Adafruit_GFX library in generating many higher-level graphics
@@ -257,6 +747,13 @@ void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color)
             y = HEIGHT - y - 1;
             break;
         }
+        uint8_t page = y / 8;
+        if (x < dirtyX1[page]) {
+            dirtyX1[page] = x;
+        }
+        if (x > dirtyX2[page]) {
+            dirtyX2[page] = x;
+        }
         switch (color) {
         case SSD1306_WHITE:
             buffer[x + (y / 8) * WIDTH] |= (1 << (y & 7));
@@ -272,72 +769,1015 @@ void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color)
 }
 
 /*!
-    @brief  Clear contents of display buffer (set all pixels to off).
+    @brief  Draw a row-major 1-bit bitmap (Adafruit_GFX drawBitmap(), XBM
+            with reversed bits, make_splash.py default output): set pixels are drawn in
+            color, clear pixels are left unchanged.
+    @param  x
+            Left column of the bitmap.
+    @param  y
+            Top row of the bitmap.
+    @param  bitmap
+            Rows of (w + 7) / 8 bytes, most significant bit leftmost.
+    @param  w
+            Width in pixels.
+    @param  h
+            Height in pixels.
+    @param  color
+            SSD1306_WHITE, SSD1306_BLACK or SSD1306_INVERSE.
     @return None (void).
-    @note   Changes buffer contents only, no immediate effect on display.
-            Follow up with a call to display(), or with other graphics
-            commands as needed by one's own application.
+    @note   With rotation 0 and y a multiple of 8, each 8x8 block of the
+            bitmap is transposed into 8 buffer bytes at once with a 64-bit
+            bit-matrix transpose, instead of one drawPixel() per pixel.
+            Other cases fall back to drawBitmap().
 */
-void Adafruit_SSD1306::clearDisplay(void) 
+void Adafruit_SSD1306::drawRowMajorBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                                          int16_t w, int16_t h, uint16_t color)
 {
-    memset(buffer, 0, WIDTH * ((HEIGHT + 7) / 8));
+    if ((getRotation() != 0) || (y & 7)) {
+        drawBitmap(x, y, bitmap, w, h, color);
+        return;
+    }
+
+    int16_t byteWidth = (w + 7) / 8;
+    startWrite();
+    for (int16_t by = 0; by < (h + 7) / 8; by++) {
+        int16_t page = y / 8 + by;
+        if ((page < 0) || (page >= (HEIGHT + 7) / 8)) {
+            continue;
+        }
+        uint8_t *dst = buffer + page * WIDTH;
+        for (int16_t bx = 0; bx < byteWidth; bx++) {
+            // Rows of the block, top one in the low byte
+            uint64_t v = 0;
+            for (uint8_t r = 0; r < 8; r++) {
+                int16_t row = by * 8 + r;
+                if (row < h) {
+                    v |= (uint64_t)pgm_read_byte(&bitmap[row * byteWidth + bx]) << (8 * r);
+                }
+            }
+            if (!v) {
+                continue;
+            }
+            v = ssd1306_transpose8x8(v);
+            // Column c of the block is now byte c, counting from the top
+            for (uint8_t c = 0; c < 8; c++) {
+                int16_t col = x + bx * 8 + c;
+                uint8_t bits = (uint8_t)(v >> (56 - 8 * c));
+                if (!bits || (bx * 8 + c >= w) || (col < 0) || (col >= WIDTH)) {
+                    continue;
+                }
+                ssd1306_apply(&dst[col], bits, color);
+            }
+        }
+    }
+    markDirty(x, y, w, h);
+    endWrite();
 }
 
 /*!
-    @brief  Return color of a single pixel in display buffer.
+    @brief  Draw a bitmap stored in the SSD1306 page format: set pixels are
+            drawn in color, clear pixels are left unchanged.
     @param  x
-            Column of display -- 0 at left to (screen width - 1) at right.
+            Left column of the bitmap.
     @param  y
-            Row of display -- 0 at top to (screen height -1) at bottom.
-    @return true if pixel is set (usually SSD1306_WHITE, unless display invert
-   mode is enabled), false if clear (SSD1306_BLACK).
-    @note   Reads from buffer contents; may not reflect current contents of
-            screen if display() has not been called.
+            Top row of the bitmap, any value.
+    @param  bitmap
+            (h + 7) / 8 pages of w bytes each, one byte per column of 8
+            pixels, least significant bit on top -- the layout of the
+            display buffer.
+    @param  w
+            Width in pixels.
+    @param  h
+            Height in pixels.
+    @param  color
+            SSD1306_WHITE, SSD1306_BLACK or SSD1306_INVERSE.
+    @return None (void).
+    @note   With rotation 0 the bitmap is combined with the buffer a byte
+            at a time, shifted across two pages when y is not a multiple
+            of 8. Other rotations draw pixel by pixel.
 */
-bool Adafruit_SSD1306::getPixel(int16_t x, int16_t y)
+void Adafruit_SSD1306::drawPageBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                                      int16_t w, int16_t h, uint16_t color)
 {
-    if ((x >= 0) && (x < width()) && (y >= 0) && (y < height())) {
-        // Pixel is in-bounds. Rotate coordinates if needed.
-        switch (getRotation()) {
-        case 1:
-            ssd1306_swap(x, y);
-            x = WIDTH - x - 1;
-            break;
-        case 2:
-            x = WIDTH - x - 1;
-            y = HEIGHT - y - 1;
-            break;
-        case 3:
-            ssd1306_swap(x, y);
-            y = HEIGHT - y - 1;
-            break;
-        }
-        return (buffer[x + (y / 8) * WIDTH] & (1 << (y & 7)));
-    }
-    return false; // Pixel out of bounds
+    ssd1306_pageBitmap(x, y, bitmap, w, h, color, color, false);
 }
 
-// A public version of ssd1306_command1(), for existing user code that
-// might rely on that function. This encapsulates the command transfer
-// in a transaction start/end, similar to old library's handling of it.
 /*!
-    @brief  Issue a single low-level command directly to the SSD1306
-            display, bypassing the library.
-    @param  c
-            Command to issue (0x00 to 0xFF, see datasheet).
+    @brief  Draw a bitmap stored in the SSD1306 page format, opaque: set
+            pixels are drawn in color, clear pixels in bg.
+    @param  x
+            Left column of the bitmap.
+    @param  y
+            Top row of the bitmap, any value.
+    @param  bitmap
+            (h + 7) / 8 pages of w bytes each, see above.
+    @param  w
+            Width in pixels.
+    @param  h
+            Height in pixels.
+    @param  color
+            Color of set pixels.
+    @param  bg
+            Color of clear pixels.
     @return None (void).
+    @note   White on black at a page-aligned y is a plain memcpy_P() of each
+            page row.
 */
-void Adafruit_SSD1306::ssd1306_command(uint8_t c) {
-    ssd1306_command1(c);
+void Adafruit_SSD1306::drawPageBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                                      int16_t w, int16_t h, uint16_t color, uint16_t bg)
+{
+    ssd1306_pageBitmap(x, y, bitmap, w, h, color, bg, true);
 }
 
 /*!
-    @brief  Get base address of display buffer for direct reading or writing.
-    @return Pointer to an unsigned 8-bit array, column-major, columns padded
-            to full byte boundary if needed.
+    @brief  Common part of the drawPageBitmap() variants. This is a
+            protected function, not exposed.
+    @param  x
+            Left column of the bitmap.
+    @param  y
+            Top row of the bitmap.
+    @param  bitmap
+            Page format bitmap.
+    @param  w
+            Width in pixels.
+    @param  h
+            Height in pixels.
+    @param  color
+            Color of set pixels.
+    @param  bg
+            Color of clear pixels, used if opaque.
+    @param  opaque
+            Draw clear pixels too.
+    @return None (void).
+*/
+void Adafruit_SSD1306::ssd1306_pageBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                                          int16_t w, int16_t h, uint16_t color,
+                                          uint16_t bg, bool opaque)
+{
+    int16_t pages = (h + 7) / 8;
+
+    startWrite();
+    if (getRotation() != 0) {
+        for (int16_t j = 0; j < h; j++) {
+            for (int16_t i = 0; i < w; i++) {
+                bool set = (pgm_read_byte(&bitmap[(j / 8) * w + i]) >> (j & 7)) & 1;
+                if (set || opaque) {
+                    drawPixel(x + i, y + j, set ? color : bg);
+                }
+            }
+        }
+        endWrite();
+        return;
+    }
+
+    int16_t c1 = (x < 0) ? -x : 0;
+    int16_t c2 = (x + w > WIDTH) ? WIDTH - x : w;
+    int16_t yPage = (y >= 0) ? y / 8 : (y - 7) / 8;
+    uint8_t shift = y - yPage * 8;
+
+    for (int16_t ip = 0; (ip < pages) && (c1 < c2); ip++) {
+        const uint8_t *src = bitmap + ip * w;
+        uint8_t m = (h - ip * 8 >= 8) ? 0xFF : (1 << (h - ip * 8)) - 1;
+        int16_t page = yPage + ip;
+
+        if (opaque && !shift && (m == 0xFF) && (color == SSD1306_WHITE) &&
+            (bg == SSD1306_BLACK) && (page >= 0) && (page < (HEIGHT + 7) / 8)) {
+            memcpy_P(buffer + page * WIDTH + x + c1, src + c1, c2 - c1);
+            continue;
+        }
+
+        // Each source byte lands in page (shifted down) and page + 1
+        for (uint8_t half = 0; half < 2; half++, page++) {
+            uint8_t mask = half ? (shift ? m >> (8 - shift) : 0) : (uint8_t)(m << shift);
+            if (!mask || (page < 0) || (page >= (HEIGHT + 7) / 8)) {
+                continue;
+            }
+            uint8_t *dst = buffer + page * WIDTH + x;
+            for (int16_t c = c1; c < c2; c++) {
+                uint8_t b = pgm_read_byte(&src[c]);
+                uint8_t bits = half ? b >> (8 - shift) : (uint8_t)(b << shift);
+                ssd1306_apply(&dst[c], bits & mask, color);
+                if (opaque) {
+                    ssd1306_apply(&dst[c], ~bits & mask, bg);
+                }
+            }
+        }
+    }
+    markDirty(x, y, w, h);
+    endWrite();
+}
+
+/*!
+    @brief  Draw a run-length encoded page format bitmap (make_splash.py
+            --rle output): set pixels are drawn in color, clear pixels are
+            left unchanged.
+    @param  x
+            Left column of the bitmap.
+    @param  y
+            Top row of the bitmap, any value.
+    @param  data
+            Width and height bytes, then the page format bytes (see
+            drawPageBitmap()) as tokens: a token byte t < 0x80 is followed
+            by t + 1 literal bytes, t >= 0x80 by one byte repeated t - 0x7E
+            times.
+    @param  color
+            SSD1306_WHITE, SSD1306_BLACK or SSD1306_INVERSE.
+    @return None (void).
+    @note   The bitmap is decoded one page row at a time into a buffer on
+            the stack and drawn with drawPageBitmap(), so RAM use does not
+            depend on the image size.
+*/
+void Adafruit_SSD1306::drawRLEBitmap(int16_t x, int16_t y, const uint8_t *data,
+                                     uint16_t color)
+{
+    ssd1306_rleBitmap(x, y, data, color, color, false);
+}
+
+/*!
+    @brief  Draw a run-length encoded page format bitmap, opaque: set pixels
+            are drawn in color, clear pixels in bg.
+    @param  x
+            Left column of the bitmap.
+    @param  y
+            Top row of the bitmap, any value.
+    @param  data
+            Encoded bitmap, see above.
+    @param  color
+            Color of set pixels.
+    @param  bg
+            Color of clear pixels.
+    @return None (void).
+*/
+void Adafruit_SSD1306::drawRLEBitmap(int16_t x, int16_t y, const uint8_t *data,
+                                     uint16_t color, uint16_t bg)
+{
+    ssd1306_rleBitmap(x, y, data, color, bg, true);
+}
+
+/*!
+    @brief  Common part of the drawRLEBitmap() variants. This is a
+            protected function, not exposed.
+    @param  x
+            Left column of the bitmap.
+    @param  y
+            Top row of the bitmap.
+    @param  data
+            Encoded bitmap.
+    @param  color
+            Color of set pixels.
+    @param  bg
+            Color of clear pixels, used if opaque.
+    @param  opaque
+            Draw clear pixels too.
+    @return None (void).
+*/
+void Adafruit_SSD1306::ssd1306_rleBitmap(int16_t x, int16_t y, const uint8_t *data,
+                                         uint16_t color, uint16_t bg, bool opaque)
+{
+    uint8_t w = pgm_read_byte(&data[0]);
+    uint8_t h = pgm_read_byte(&data[1]);
+    const uint8_t *src = data + 2;
+    uint8_t row[255];
+    uint8_t run = 0, literal = 0, value = 0;
+
+    startWrite();
+    for (int16_t j = 0; j < h; j += 8) {
+        // Runs and literals may continue across page rows
+        for (uint8_t c = 0; c < w; c++) {
+            if (!run && !literal) {
+                uint8_t t = pgm_read_byte(src++);
+                if (t & 0x80) {
+                    run = t - 0x7E;
+                    value = pgm_read_byte(src++);
+                }
+                else {
+                    literal = t + 1;
+                }
+            }
+            if (run) {
+                row[c] = value;
+                run--;
+            }
+            else {
+                row[c] = pgm_read_byte(src++);
+                literal--;
+            }
+        }
+        ssd1306_pageBitmap(x, y + j, row, w, (h - j < 8) ? h - j : 8, color, bg, opaque);
+    }
+    endWrite();
+}
+
+/*!
+    @brief  Copy a rectangle of the buffer to another position, like
+            memmove(): source and destination may overlap.
+    @param  sx
+            Left column of the source.
+    @param  sy
+            Top row of the source.
+    @param  w
+            Width in pixels.
+    @param  h
+            Height in pixels.
+    @param  dx
+            Left column of the destination.
+    @param  dy
+            Top row of the destination.
+    @return None (void).
+    @note   The rectangle is clipped so source and destination are both on
+            the display. With rotation 0 whole pages moved by a multiple of
+            8 rows are a memmove() of each page row, other cases combine
+            two source pages per destination byte. Other rotations copy
+            pixel by pixel.
+*/
+void Adafruit_SSD1306::copyRect(int16_t sx, int16_t sy, int16_t w, int16_t h,
+                                int16_t dx, int16_t dy)
+{
+    if (sx < 0) {
+        w += sx;
+        dx -= sx;
+        sx = 0;
+    }
+    if (dx < 0) {
+        w += dx;
+        sx -= dx;
+        dx = 0;
+    }
+    if (sy < 0) {
+        h += sy;
+        dy -= sy;
+        sy = 0;
+    }
+    if (dy < 0) {
+        h += dy;
+        sy -= dy;
+        dy = 0;
+    }
+    if (sx + w > width()) {
+        w = width() - sx;
+    }
+    if (dx + w > width()) {
+        w = width() - dx;
+    }
+    if (sy + h > height()) {
+        h = height() - sy;
+    }
+    if (dy + h > height()) {
+        h = height() - dy;
+    }
+    if ((w <= 0) || (h <= 0) || ((sx == dx) && (sy == dy))) {
+        return;
+    }
+
+    // Walk away from the destination so nothing is overwritten before it
+    // is read
+    int16_t iStep = (dx > sx) ? -1 : 1;
+    int16_t jStep = (dy > sy) ? -1 : 1;
+
+    startWrite();
+    if (getRotation() != 0) {
+        for (int16_t j = (jStep < 0) ? h - 1 : 0; (j >= 0) && (j < h); j += jStep) {
+            for (int16_t i = (iStep < 0) ? w - 1 : 0; (i >= 0) && (i < w); i += iStep) {
+                drawPixel(dx + i, dy + j, getPixel(sx + i, sy + j) ? SSD1306_WHITE : SSD1306_BLACK);
+            }
+        }
+        endWrite();
+        return;
+    }
+
+    int16_t pages = (HEIGHT + 7) / 8;
+    int16_t page1 = dy / 8;
+    int16_t page2 = (dy + h - 1) / 8;
+    int16_t offset = dy - sy;
+
+    for (int16_t page = (jStep < 0) ? page2 : page1; (page >= page1) && (page <= page2); page += jStep) {
+        // Rows of this page come from page sp shifted up by sh, and sp + 1
+        int16_t top = page * 8 - offset;
+        int16_t sp = (top >= 0) ? top / 8 : (top - 7) / 8;
+        uint8_t sh = top - sp * 8;
+        int16_t r1 = (dy > page * 8) ? dy - page * 8 : 0;
+        int16_t r2 = (dy + h < page * 8 + 8) ? dy + h - page * 8 : 8;
+        uint8_t mask = (uint8_t)(0xFF << r1) & (0xFF >> (8 - r2));
+        uint8_t *dst = buffer + page * WIDTH + dx;
+        int16_t src = sp * WIDTH + sx;
+
+        if (!sh && (mask == 0xFF)) {
+            memmove(dst, buffer + src, w);
+            continue;
+        }
+        for (int16_t i = (iStep < 0) ? w - 1 : 0; (i >= 0) && (i < w); i += iStep) {
+            uint8_t b = 0;
+            if ((sp >= 0) && (sp < pages)) {
+                b = buffer[src + i] >> sh;
+            }
+            if (sh && (sp + 1 < pages)) {
+                b |= buffer[src + WIDTH + i] << (8 - sh);
+            }
+            dst[i] = (dst[i] & ~mask) | (b & mask);
+        }
+    }
+    markDirty(dx, dy, w, h);
+    endWrite();
+}
+
+/*!
+    @brief  Scroll the contents of a rectangle within it, in the buffer. The
+            strips uncovered by the move are filled with a color.
+    @param  x
+            Left column of the rectangle.
+    @param  y
+            Top row of the rectangle.
+    @param  w
+            Width in pixels.
+    @param  h
+            Height in pixels.
+    @param  dx
+            Pixels to move right, negative to move left.
+    @param  dy
+            Pixels to move down, negative to move up.
+    @param  color
+            Color of the uncovered strips, SSD1306_BLACK (default) or
+            SSD1306_WHITE.
+    @return None (void).
+    @note   Unlike startscrollright() and friends this changes the buffer,
+            so scrolling a graph by one column and drawing only the new one
+            replaces redrawing every point. Follow up with displayDirty().
+*/
+void Adafruit_SSD1306::scrollRegion(int16_t x, int16_t y, int16_t w, int16_t h,
+                                    int16_t dx, int16_t dy, uint16_t color)
+{
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    if (x + w > width()) {
+        w = width() - x;
+    }
+    if (y + h > height()) {
+        h = height() - y;
+    }
+    if ((w <= 0) || (h <= 0)) {
+        return;
+    }
+
+    startWrite();
+    if ((abs(dx) >= w) || (abs(dy) >= h)) {
+        ssd1306_fillRect(x, y, w, h, color);
+        endWrite();
+        return;
+    }
+    copyRect(x + ((dx < 0) ? -dx : 0), y + ((dy < 0) ? -dy : 0), w - abs(dx), h - abs(dy),
+             x + ((dx > 0) ? dx : 0), y + ((dy > 0) ? dy : 0));
+    if (dx) {
+        ssd1306_fillRect((dx > 0) ? x : x + w + dx, y, abs(dx), h, color);
+    }
+    if (dy) {
+        ssd1306_fillRect(x, (dy > 0) ? y : y + h + dy, w, abs(dy), color);
+    }
+    endWrite();
+}
+
+/*!
+    @brief  Invert the pixels of a rectangle, e.g. a menu highlight bar or
+            a blinking cursor; inverting again restores them.
+    @param  x
+            Left column.
+    @param  y
+            Top row.
+    @param  w
+            Width in pixels.
+    @param  h
+            Height in pixels.
+    @return None (void).
+    @note   With rotation 0 each page byte is XORed with a mask of the
+            rows inside the rectangle, instead of one drawPixel() per pixel.
+*/
+void Adafruit_SSD1306::invertRect(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    ssd1306_fillRect(x, y, w, h, SSD1306_INVERSE);
+}
+
+/*!
+    @brief  XOR a page format bitmap into the buffer: set pixels are
+            inverted, clear pixels are left unchanged, so drawing it twice
+            restores the buffer.
+    @param  x
+            Left column of the bitmap.
+    @param  y
+            Top row of the bitmap, any value.
+    @param  bitmap
+            (h + 7) / 8 pages of w bytes each, see drawPageBitmap().
+    @param  w
+            Width in pixels.
+    @param  h
+            Height in pixels.
+    @return None (void).
+    @note   Same as drawPageBitmap() with SSD1306_INVERSE: whole bytes,
+            shifted across two pages when y is not a multiple of 8. For
+            row-major bitmaps use drawRowMajorBitmap() with SSD1306_INVERSE.
+*/
+void Adafruit_SSD1306::xorBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                                 int16_t w, int16_t h)
+{
+    ssd1306_pageBitmap(x, y, bitmap, w, h, SSD1306_INVERSE, SSD1306_INVERSE, false);
+}
+
+/*!
+    @brief  Fill a rectangle a page byte at a time, with a mask for the
+            partial pages at its top and bottom. This is a protected
+            function, not exposed.
+    @param  x
+            Left column.
+    @param  y
+            Top row.
+    @param  w
+            Width in pixels.
+    @param  h
+            Height in pixels.
+    @param  color
+            SSD1306_WHITE, SSD1306_BLACK or SSD1306_INVERSE.
+    @return None (void).
+    @note   Other rotations than 0 use Adafruit_GFX::fillRect().
+*/
+void Adafruit_SSD1306::ssd1306_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                        uint16_t color)
+{
+    if (getRotation() != 0) {
+        Adafruit_GFX::fillRect(x, y, w, h, color);
+        return;
+    }
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    if (x + w > WIDTH) {
+        w = WIDTH - x;
+    }
+    if (y + h > HEIGHT) {
+        h = HEIGHT - y;
+    }
+    if ((w <= 0) || (h <= 0)) {
+        return;
+    }
+
+    startWrite();
+    for (int16_t page = y / 8; page <= (y + h - 1) / 8; page++) {
+        int16_t r1 = (y > page * 8) ? y - page * 8 : 0;
+        int16_t r2 = (y + h < page * 8 + 8) ? y + h - page * 8 : 8;
+        uint8_t mask = (uint8_t)(0xFF << r1) & (0xFF >> (8 - r2));
+        uint8_t *dst = buffer + page * WIDTH + x;
+        if ((mask == 0xFF) && (color != SSD1306_INVERSE)) {
+            memset(dst, (color == SSD1306_WHITE) ? 0xFF : 0x00, w);
+            continue;
+        }
+        for (int16_t i = 0; i < w; i++) {
+            ssd1306_apply(&dst[i], mask, color);
+        }
+    }
+    markDirty(x, y, w, h);
+    endWrite();
+}
+
+/*!
+    @brief  Clear contents of display buffer (set all pixels to off).
+    @return None (void).
+    @note   Changes buffer contents only, no immediate effect on display.
+            Follow up with a call to display(), or with other graphics
+            commands as needed by one's own application.
+*/
+void Adafruit_SSD1306::clearDisplay(void) 
+{
+    memset(buffer, 0, WIDTH * ((HEIGHT + 7) / 8));
+    markDirty();
+}
+
+/*!
+    @brief  Return color of a single pixel in display buffer.
+    @param  x
+            Column of display -- 0 at left to (screen width - 1) at right.
+    @param  y
+            Row of display -- 0 at top to (screen height -1) at bottom.
+    @return true if pixel is set (usually SSD1306_WHITE, unless display invert
+   mode is enabled), false if clear (SSD1306_BLACK).
+    @note   Reads from buffer contents; may not reflect current contents of
+            screen if display() has not been called.
+*/
+bool Adafruit_SSD1306::getPixel(int16_t x, int16_t y)
+{
+    if ((x >= 0) && (x < width()) && (y >= 0) && (y < height())) {
+        // Pixel is in-bounds. Rotate coordinates if needed.
+        switch (getRotation()) {
+        case 1:
+            ssd1306_swap(x, y);
+            x = WIDTH - x - 1;
+            break;
+        case 2:
+            x = WIDTH - x - 1;
+            y = HEIGHT - y - 1;
+            break;
+        case 3:
+            ssd1306_swap(x, y);
+            y = HEIGHT - y - 1;
+            break;
+        }
+        return (buffer[x + (y / 8) * WIDTH] & (1 << (y & 7)));
+    }
+    return false; // Pixel out of bounds
+}
+
+// A public version of ssd1306_command1(), for existing user code that
+// might rely on that function. This encapsulates the command transfer
+// in a transaction start/end, similar to old library's handling of it.
+/*!
+    @brief  Issue a single low-level command directly to the SSD1306
+            display, bypassing the library.
+    @param  c
+            Command to issue (0x00 to 0xFF, see datasheet).
+    @return None (void).
+*/
+void Adafruit_SSD1306::ssd1306_command(uint8_t c) {
+    ssd1306_command1(c);
+}
+
+/*!
+    @brief  Get base address of display buffer for direct reading or writing.
+    @return Pointer to an unsigned 8-bit array, column-major, columns padded
+            to full byte boundary if needed.
 */
 uint8_t *Adafruit_SSD1306::getBuffer(void) { return buffer; }
 
+/*!
+    @brief  Write the buffer as a packed (P4) PBM image, e.g. to capture
+            the screen of a unit in the field over a debug UART.
+    @param  writer
+            Function receiving the image bytes, called once for the header
+            and once per pixel row.
+    @param  context
+            Passed unchanged to writer.
+    @return Number of bytes written, 0 if the buffer is not allocated.
+    @note   The image is in buffer (unrotated) orientation, as the panel
+            shows it. Pages are converted 8x8 pixels at a time; with
+            locking enabled the draw lock is held for one page of 8 rows at
+            a time only, so rendering in other tasks goes on meanwhile.
+*/
+size_t Adafruit_SSD1306::writePBM(ssd1306_writer_t writer, void *context)
+{
+    char header[16];
+    uint8_t band[8 * 32]; // 8 rows of up to 255 pixels
+    uint8_t rowBytes = (WIDTH + 7) / 8;
+    size_t total;
+
+    if (!buffer) {
+        return 0;
+    }
+
+    total = snprintf(header, sizeof(header), "P4\n%d %d\n", WIDTH, HEIGHT);
+    writer(context, (const uint8_t *)header, total);
+
+    for (int16_t page = 0; page < (HEIGHT + 7) / 8; page++) {
+        const uint8_t *src = buffer + page * WIDTH;
+
+        startWrite();
+        for (uint8_t block = 0; block < rowBytes; block++) {
+            // Columns of the block, left one in the top byte
+            uint64_t x = 0;
+            for (uint8_t i = 0; i < 8; i++) {
+                uint8_t col = block * 8 + i;
+                x = (x << 8) | ((col < WIDTH) ? src[col] : 0);
+            }
+            x = ssd1306_transpose8x8(x);
+            // Row r of the image is now byte r, counting from the bottom
+            for (uint8_t r = 0; r < 8; r++) {
+                band[r * rowBytes + block] = (uint8_t)(x >> (8 * r));
+            }
+        }
+        endWrite();
+
+        for (uint8_t r = 0; (r < 8) && (page * 8 + r < HEIGHT); r++) {
+            writer(context, band + r * rowBytes, rowBytes);
+            total += rowBytes;
+        }
+    }
+    return total;
+}
+
+// TEXT --------------------------------------------------------------------
+
+/*!
+    @brief  Draw text through a cache of pre-rendered glyphs.
+    @param  cache
+            Glyph cache, may be shared by several displays, also from
+            several tasks; NULL (default) draws text with Adafruit_GFX.
+    @return None (void).
+    @note   The cache is used with rotation 0 only.
+*/
+void Adafruit_SSD1306::setGlyphCache(Adafruit_SSD1306_GlyphCache *cache)
+{
+    glyphCache = cache;
+}
+
+/*!
+    @brief  Print one character at the cursor (Print interface). Same
+            layout as Adafruit_GFX::write(), but glyphs come from the
+            cache set with setGlyphCache() if there is one.
+    @param  c
+            Character.
+    @return 1.
+*/
+size_t Adafruit_SSD1306::write(uint8_t c)
+{
+    if (!glyphCache || rotation) {
+        return Adafruit_GFX::write(c);
+    }
+
+    startWrite();
+    if (!gfxFont) {
+        if (c == '\n') {
+            cursor_x = 0;
+            cursor_y += textsize_y * 8;
+        }
+        else if (c != '\r') {
+            if (wrap && ((cursor_x + textsize_x * 6) > _width)) {
+                cursor_x = 0;
+                cursor_y += textsize_y * 8;
+            }
+            ssd1306_drawChar(cursor_x, cursor_y, c);
+            cursor_x += textsize_x * 6;
+        }
+    }
+    else {
+        uint8_t yAdvance = pgm_read_byte(&gfxFont->yAdvance);
+        uint16_t first = pgm_read_word(&gfxFont->first);
+        if (c == '\n') {
+            cursor_x = 0;
+            cursor_y += (int16_t)textsize_y * yAdvance;
+        }
+        else if ((c != '\r') && (c >= first) && (c <= pgm_read_word(&gfxFont->last))) {
+            const GFXglyph *glyph = gfxFont->glyph + (c - first);
+            uint8_t w = pgm_read_byte(&glyph->width);
+            if (w && pgm_read_byte(&glyph->height)) {
+                int16_t xo = (int8_t)pgm_read_byte(&glyph->xOffset);
+                if (wrap && ((cursor_x + textsize_x * (xo + w)) > _width)) {
+                    cursor_x = 0;
+                    cursor_y += (int16_t)textsize_y * yAdvance;
+                }
+                ssd1306_drawChar(cursor_x, cursor_y, c);
+            }
+            cursor_x += (uint8_t)pgm_read_byte(&glyph->xAdvance) * (int16_t)textsize_x;
+        }
+    }
+    endWrite();
+    return 1;
+}
+
+/*!
+    @brief  Draw a character with the current font, size and colors from
+            the glyph cache. This is a protected function, not exposed.
+    @param  x
+            Cursor column.
+    @param  y
+            Cursor row (top for the built-in font, baseline for GFXfonts).
+    @param  c
+            Character.
+    @return None (void).
+    @note   Falls back to Adafruit_GFX::drawChar() for glyphs the cache
+            cannot hold.
+*/
+void Adafruit_SSD1306::ssd1306_drawChar(int16_t x, int16_t y, uint8_t c)
+{
+    // Built-in font: cp437() off skips code 176, see Adafruit_GFX::drawChar()
+    uint8_t key = (!gfxFont && !_cp437 && (c >= 176)) ? c + 1 : c;
+    // Held until the glyph is drawn, another task could replace it
+    SemaphoreHandle_t lock = glyphCache->getLock();
+    if (lock) {
+        xSemaphoreTakeRecursive(lock, portMAX_DELAY);
+    }
+    const ssd1306_glyph_t *glyph = glyphCache->get(gfxFont, key, textsize_x, textsize_y);
+
+    if (!glyph) {
+        Adafruit_GFX::drawChar(x, y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+    }
+    else if (!gfxFont && (textbgcolor != textcolor)) {
+        drawPageBitmap(x, y, glyphCache->getBitmap(glyph), glyph->width, glyph->height,
+                       textcolor, textbgcolor);
+    }
+    else if (glyph->width) {
+        drawPageBitmap(x + glyph->xOffset, y + glyph->yOffset, glyphCache->getBitmap(glyph),
+                       glyph->width, glyph->height, textcolor);
+    }
+    if (lock) {
+        xSemaphoreGiveRecursive(lock);
+    }
+}
+
+
+/*!
+    @brief  Look up the kerning of a character pair.
+    @param  font
+            Page format font.
+    @param  left
+            Left character.
+    @param  right
+            Right character.
+    @return Pixels to add to the advance of left, 0 if the pair is not
+            listed.
+*/
+static int8_t ssd1306_kerning(const ssd1306_font_t *font, uint8_t left, uint8_t right)
+{
+    const ssd1306_font_kern_t *pairs =
+        (const ssd1306_font_kern_t *)pgm_read_pointer(&font->kerning);
+    uint16_t lo = 0, hi = pgm_read_word(&font->kerningCount);
+    uint16_t key = (left << 8) | right;
+
+    // Pairs are sorted by left, then right
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        uint16_t k = (pgm_read_byte(&pairs[mid].left) << 8) | pgm_read_byte(&pairs[mid].right);
+        if (k == key) {
+            return (int8_t)pgm_read_byte(&pairs[mid].adjust);
+        }
+        if (k < key) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return 0;
+}
+
+/*!
+    @brief  Draw text in a page format font (scripts/make_font.py output):
+            set pixels are drawn in color, the rest is left unchanged.
+    @param  x
+            Left column of the text, the cursor of the first character.
+    @param  y
+            Top row of the text; the baseline is font->baseline rows
+            lower. Rows that are a multiple of 8 are fastest.
+    @param  font
+            Page format font.
+    @param  text
+            Text to draw, '\n' starts a new line font->yAdvance rows lower
+            at column x. Characters missing from the font are skipped.
+    @param  color
+            SSD1306_WHITE, SSD1306_BLACK or SSD1306_INVERSE.
+    @return Cursor column after the last character.
+*/
+int16_t Adafruit_SSD1306::drawPageText(int16_t x, int16_t y, const ssd1306_font_t *font,
+                                       const char *text, uint16_t color)
+{
+    return ssd1306_pageText(x, y, font, text, color, color, false);
+}
+
+/*!
+    @brief  Draw text in a page format font, opaque: the text cells from
+            the top of the font to its bottom are filled with bg.
+    @param  x
+            Left column of the text.
+    @param  y
+            Top row of the text.
+    @param  font
+            Page format font.
+    @param  text
+            Text to draw.
+    @param  color
+            Color of the text.
+    @param  bg
+            Background color.
+    @return Cursor column after the last character.
+    @note   Each character cell is drawn in turn, so with negative
+            kerning or offsets a cell may clip the previous glyph.
+*/
+int16_t Adafruit_SSD1306::drawPageText(int16_t x, int16_t y, const ssd1306_font_t *font,
+                                       const char *text, uint16_t color, uint16_t bg)
+{
+    return ssd1306_pageText(x, y, font, text, color, bg, true);
+}
+
+/*!
+    @brief  Measure text in a page format font.
+    @param  font
+            Page format font.
+    @param  text
+            Text to measure.
+    @return Advance of the widest line in pixels, kerning included.
+*/
+int16_t Adafruit_SSD1306::getPageTextWidth(const ssd1306_font_t *font, const char *text)
+{
+    const ssd1306_font_glyph_t *glyphs =
+        (const ssd1306_font_glyph_t *)pgm_read_pointer(&font->glyphs);
+    uint8_t first = pgm_read_byte(&font->first);
+    uint8_t last = pgm_read_byte(&font->last);
+    int16_t width = 0, x = 0;
+
+    for (; *text; text++) {
+        uint8_t c = *text;
+        if (c == '\n') {
+            x = 0;
+            continue;
+        }
+        if ((c < first) || (c > last)) {
+            continue;
+        }
+        x += pgm_read_byte(&glyphs[c - first].advance);
+        if (text[1]) {
+            x += ssd1306_kerning(font, c, text[1]);
+        }
+        if (x > width) {
+            width = x;
+        }
+    }
+    return width;
+}
+
+/*!
+    @brief  Common part of the drawPageText() variants. This is a
+            protected function, not exposed.
+    @param  x
+            Left column of the text.
+    @param  y
+            Top row of the text.
+    @param  font
+            Page format font.
+    @param  text
+            Text to draw.
+    @param  color
+            Color of the text.
+    @param  bg
+            Background color, used if opaque.
+    @param  opaque
+            Fill the character cells with bg.
+    @return Cursor column after the last character.
+*/
+int16_t Adafruit_SSD1306::ssd1306_pageText(int16_t x, int16_t y, const ssd1306_font_t *font,
+                                           const char *text, uint16_t color, uint16_t bg,
+                                           bool opaque)
+{
+    const uint8_t *bitmap = (const uint8_t *)pgm_read_pointer(&font->bitmap);
+    const ssd1306_font_glyph_t *glyphs =
+        (const ssd1306_font_glyph_t *)pgm_read_pointer(&font->glyphs);
+    uint8_t first = pgm_read_byte(&font->first);
+    uint8_t last = pgm_read_byte(&font->last);
+    uint8_t h = pgm_read_byte(&font->height);
+    int16_t x0 = x, ink = x;
+
+    startWrite();
+    for (; *text; text++) {
+        uint8_t c = *text;
+        if (c == '\n') {
+            x = ink = x0;
+            y += pgm_read_byte(&font->yAdvance);
+            continue;
+        }
+        if ((c < first) || (c > last)) {
+            continue;
+        }
+        const ssd1306_font_glyph_t *glyph = &glyphs[c - first];
+        uint8_t w = pgm_read_byte(&glyph->width);
+        int16_t gx = x + (int8_t)pgm_read_byte(&glyph->xOffset);
+        int16_t next = x + pgm_read_byte(&glyph->advance);
+        if (text[1]) {
+            next += ssd1306_kerning(font, c, text[1]);
+        }
+
+        if (!w) {
+            gx = next;
+        }
+        else if (opaque) {
+            drawPageBitmap(gx, y, bitmap + pgm_read_word(&glyph->offset), w, h, color, bg);
+        }
+        else {
+            drawPageBitmap(gx, y, bitmap + pgm_read_word(&glyph->offset), w, h, color);
+        }
+        if (opaque) {
+            // Bearing before the ink and spacing after it. A negative
+            // kerning pair moves x back into the previous ink, keep it.
+            int16_t from = (x > ink) ? x : ink;
+            if (gx > from) {
+                fillRect(from, y, gx - from, h, bg);
+            }
+            if (next > gx + w) {
+                fillRect(gx + w, y, next - gx - w, h, bg);
+            }
+            if (gx + w > ink) {
+                ink = gx + w;
+            }
+        }
+        x = next;
+    }
+    endWrite();
+    return x;
+}
+
+
 // REFRESH DISPLAY ---------------------------------------------------------
 
 /*!
@@ -349,30 +1789,212 @@ uint8_t *Adafruit_SSD1306::getBuffer(void) { return buffer; }
 */
 void Adafruit_SSD1306::display(void)
 {
-    static const uint8_t dlist1[] = {
-        SSD1306_PAGEADDR,
-        0,                      // Page start address
-        0xFF,                   // Page end (not really, but works here)
-        SSD1306_COLUMNADDR, 0}; // Column start address
-    ssd1306_commandList(dlist1, sizeof(dlist1));
-    ssd1306_command1(WIDTH - 1); // Column end address
+    int64_t since = esp_timer_get_time();
 
-    uint16_t count = WIDTH * ((HEIGHT + 7) / 8);
-    uint8_t *ptr = buffer;
+    startWrite();
+    memset(dirtyX1, 0xFF, sizeof(dirtyX1));
+    memset(dirtyX2, 0, sizeof(dirtyX2));
+    endWrite();
+    ssd1306_window(0, WIDTH - 1, 0, (HEIGHT + 7) / 8 - 1);
+    ssd1306_mirrorEnd();
+    ssd1306_countDisplay(since);
+}
 
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+/*!
+    @brief  Push only the parts of the buffer changed since the last update.
+    @return None (void).
+    @note   Consecutive changed pages are sent together as one window
+            covering their widest column span. Changes made by writing to
+            getBuffer() directly must be reported with markDirty().
+*/
+void Adafruit_SSD1306::displayDirty(void)
+{
+    int64_t since = esp_timer_get_time();
+    uint8_t pages = (HEIGHT + 7) / 8;
 
-	i2c_master_start(cmd);
-	i2c_master_write_byte(cmd, (i2caddr << 1) | I2C_MASTER_WRITE, true);
-	i2c_master_write_byte(cmd, SSD1306_CONTROL_BYTE_DATA_STREAM, true);
+    for (uint8_t page1 = 0; page1 < pages; page1++) {
+        startWrite();
+        if (dirtyX1[page1] > dirtyX2[page1]) {
+            endWrite();
+            continue;
+        }
+        uint8_t x1 = dirtyX1[page1];
+        uint8_t x2 = dirtyX2[page1];
+        uint8_t page2 = page1;
+        while ((page2 + 1 < pages) && (dirtyX1[page2 + 1] <= dirtyX2[page2 + 1])) {
+            page2++;
+            if (dirtyX1[page2] < x1) {
+                x1 = dirtyX1[page2];
+            }
+            if (dirtyX2[page2] > x2) {
+                x2 = dirtyX2[page2];
+            }
+        }
+        for (uint8_t page = page1; page <= page2; page++) {
+            dirtyX1[page] = 0xFF;
+            dirtyX2[page] = 0;
+        }
+        endWrite();
+        ssd1306_window(x1, x2, page1, page2);
+        page1 = page2;
+    }
+    ssd1306_mirrorEnd();
+    ssd1306_countDisplay(since);
+}
 
-    while (count--) {
-        i2c_master_write_byte(cmd, *ptr++, true);
+/*!
+    @brief  Push the changed column span of the first changed page only.
+    @return true if other pages are still waiting to be sent, false once
+            the display is up to date.
+    @note   Lets a caller interleave updates of several displays sharing
+            one bus a page at a time, see Adafruit_SSD1306_Manager.
+*/
+bool Adafruit_SSD1306::displayDirtyPage(void)
+{
+    uint8_t pages = (HEIGHT + 7) / 8;
+
+    startWrite();
+    for (uint8_t page = 0; page < pages; page++) {
+        if (dirtyX1[page] <= dirtyX2[page]) {
+            uint8_t x1 = dirtyX1[page];
+            uint8_t x2 = dirtyX2[page];
+            dirtyX1[page] = 0xFF;
+            dirtyX2[page] = 0;
+            endWrite();
+            ssd1306_window(x1, x2, page, page);
+            if (isDirty()) {
+                return true;
+            }
+            ssd1306_mirrorEnd();
+            return false;
+        }
     }
+    endWrite();
+    return false;
+}
 
-    i2c_master_stop(cmd);
-    ESP_ERROR_CHECK_WITHOUT_ABORT(i2c_master_cmd_begin(i2c, cmd, 10/portTICK_PERIOD_MS));
-    i2c_cmd_link_delete(cmd);
+/*!
+    @brief  Check for buffer changes not yet pushed to the display.
+    @return true if displayDirty() has something to send.
+*/
+bool Adafruit_SSD1306::isDirty(void)
+{
+    uint8_t pages = (HEIGHT + 7) / 8;
+
+    for (uint8_t page = 0; page < pages; page++) {
+        if (dirtyX1[page] <= dirtyX2[page]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*!
+    @brief  Flag the whole buffer as changed.
+    @return None (void).
+*/
+void Adafruit_SSD1306::markDirty(void)
+{
+    memset(dirtyX1, 0, sizeof(dirtyX1));
+    memset(dirtyX2, WIDTH - 1, sizeof(dirtyX2));
+}
+
+/*!
+    @brief  Flag part of the buffer as changed, for code that writes to
+            getBuffer() directly.
+    @param  x
+            First column, in buffer (unrotated) coordinates.
+    @param  y
+            First row, in buffer (unrotated) coordinates.
+    @param  w
+            Width in pixels.
+    @param  h
+            Height in pixels.
+    @return None (void).
+*/
+void Adafruit_SSD1306::markDirty(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    int16_t x2 = x + w - 1;
+    int16_t y2 = y + h - 1;
+
+    if (x < 0) {
+        x = 0;
+    }
+    if (y < 0) {
+        y = 0;
+    }
+    if (x2 >= WIDTH) {
+        x2 = WIDTH - 1;
+    }
+    if (y2 >= HEIGHT) {
+        y2 = HEIGHT - 1;
+    }
+    if ((x > x2) || (y > y2)) {
+        return;
+    }
+    for (int16_t page = y / 8; page <= y2 / 8; page++) {
+        if (x < dirtyX1[page]) {
+            dirtyX1[page] = x;
+        }
+        if (x2 > dirtyX2[page]) {
+            dirtyX2[page] = x2;
+        }
+    }
+}
+
+/*!
+    @brief  Set the SSD1306 address window and push the matching rectangle
+            of the buffer. This is a protected function, not exposed.
+    @param  x1
+            First column.
+    @param  x2
+            Last column.
+    @param  page1
+            First page (8 rows each).
+    @param  page2
+            Last page.
+    @return None (void).
+*/
+void Adafruit_SSD1306::ssd1306_window(uint8_t x1, uint8_t x2, uint8_t page1, uint8_t page2)
+{
+    const uint8_t dlist[] = {
+        SSD1306_PAGEADDR,
+        page1,                  // Page start address
+        page2,                  // Page end address
+        SSD1306_COLUMNADDR,
+        x1,                     // Column start address
+        x2};                    // Column end address
+    uint8_t w = x2 - x1 + 1;
+    uint8_t rows = page2 - page1 + 1;
+    const uint8_t *src = buffer + page1 * WIDTH + x1;
+    uint16_t stride = WIDTH;
+
+    if (txBuffer) {
+        // Send a snapshot so drawing can go on during the transfer
+        startWrite();
+        for (uint8_t i = 0; i < rows; i++) {
+            memcpy(txBuffer + i * w, src + i * WIDTH, w);
+        }
+        endWrite();
+        src = txBuffer;
+        stride = w;
+    }
+
+    ssd1306_lockBus();
+    ssd1306_commandList(dlist, sizeof(dlist));
+    if (stride == w) {
+        // Rows are contiguous, send them as one run
+        ssd1306_transfer(SSD1306_CONTROL_BYTE_DATA_STREAM, src, w * rows);
+    }
+    else {
+        ssd1306_transfer(SSD1306_CONTROL_BYTE_DATA_STREAM, src, w, rows, stride);
+    }
+    if (mirror) {
+        for (uint8_t i = 0; i < rows; i++) {
+            mirror(mirrorContext, page1 + i, x1, w, src + i * stride);
+        }
+    }
+    ssd1306_unlockBus();
 }
 
 // SCROLLING FUNCTIONS -----------------------------------------------------
@@ -388,6 +2010,7 @@ void Adafruit_SSD1306::display(void)
 // To scroll the whole display, run: display.startscrollright(0x00, 0x0F)
 void Adafruit_SSD1306::startscrollright(uint8_t start, uint8_t stop) 
 {
+    ssd1306_lockBus();
     static const uint8_t scrollList1a[] = {
         SSD1306_RIGHT_HORIZONTAL_SCROLL, 
         0X00
@@ -402,6 +2025,7 @@ void Adafruit_SSD1306::startscrollright(uint8_t start, uint8_t stop)
         SSD1306_ACTIVATE_SCROLL
     };
     ssd1306_commandList(scrollList1b, sizeof(scrollList1b));
+    ssd1306_unlockBus();
 }
 
 /*!
@@ -415,6 +2039,7 @@ void Adafruit_SSD1306::startscrollright(uint8_t start, uint8_t stop)
 // To scroll the whole display, run: display.startscrollleft(0x00, 0x0F)
 void Adafruit_SSD1306::startscrollleft(uint8_t start, uint8_t stop)
 {
+    ssd1306_lockBus();
     static const uint8_t scrollList2a[] = {
         SSD1306_LEFT_HORIZONTAL_SCROLL,
         0X00
@@ -429,6 +2054,7 @@ void Adafruit_SSD1306::startscrollleft(uint8_t start, uint8_t stop)
         SSD1306_ACTIVATE_SCROLL
     };
     ssd1306_commandList(scrollList2b, sizeof(scrollList2b));
+    ssd1306_unlockBus();
 }
 
 /*!
@@ -442,6 +2068,7 @@ void Adafruit_SSD1306::startscrollleft(uint8_t start, uint8_t stop)
 // display.startscrolldiagright(0x00, 0x0F)
 void Adafruit_SSD1306::startscrolldiagright(uint8_t start, uint8_t stop)
 {
+    ssd1306_lockBus();
     static const uint8_t scrollList3a[] = {
         SSD1306_SET_VERTICAL_SCROLL_AREA, 
         0X00
@@ -461,6 +2088,7 @@ void Adafruit_SSD1306::startscrolldiagright(uint8_t start, uint8_t stop)
         SSD1306_ACTIVATE_SCROLL
     };
     ssd1306_commandList(scrollList3c, sizeof(scrollList3c));
+    ssd1306_unlockBus();
 }
 
 /*!
@@ -474,6 +2102,7 @@ void Adafruit_SSD1306::startscrolldiagright(uint8_t start, uint8_t stop)
 // To scroll the whole display, run: display.startscrolldiagleft(0x00, 0x0F)
 void Adafruit_SSD1306::startscrolldiagleft(uint8_t start, uint8_t stop)
 {
+    ssd1306_lockBus();
     static const uint8_t scrollList4a[] = {
         SSD1306_SET_VERTICAL_SCROLL_AREA, 
         0X00
@@ -493,6 +2122,7 @@ void Adafruit_SSD1306::startscrolldiagleft(uint8_t start, uint8_t stop)
         SSD1306_ACTIVATE_SCROLL
     };
     ssd1306_commandList(scrollList4c, sizeof(scrollList4c));
+    ssd1306_unlockBus();
 }
 
 /*!
@@ -535,6 +2165,8 @@ void Adafruit_SSD1306::invertDisplay(bool i) {
 void Adafruit_SSD1306::dim(bool dim) {
     // the range of contrast to too small to be really useful
     // it is useful to dim the display
+    ssd1306_lockBus();
     ssd1306_command1(SSD1306_SETCONTRAST);
     ssd1306_command1(dim ? 0 : contrast);
+    ssd1306_unlockBus();
 }
\ No newline at end of file
@@ -25,7 +25,13 @@
 #define _Adafruit_SSD1306_H_
 
 #include "driver/i2c.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include <Adafruit_GFX.h>
+#include "Adafruit_SSD1306_Mux.h"
+#include "Adafruit_SSD1306_Font.h"
+
+class Adafruit_SSD1306_GlyphCache;
 
 // Control byte
 #define SSD1306_CONTROL_BYTE_CMD_SINGLE    0x80
@@ -82,6 +88,50 @@
 #define SSD1306_ACTIVATE_SCROLL 0x2F                      ///< Start scroll
 #define SSD1306_SET_VERTICAL_SCROLL_AREA 0xA3             ///< Set scroll range
 
+#define SSD1306_MAX_PAGES 8 ///< GDDRAM pages on the controller (64 rows)
+
+/// Usage of one of the locks taken when locking is enabled
+typedef struct {
+    uint32_t count;       ///< Times the lock was taken (outermost only)
+    uint32_t contended;   ///< Times the lock was held by another task
+    uint32_t maxWaitUs;   ///< Longest wait for the lock, microseconds
+    uint32_t maxHoldUs;   ///< Longest time the lock was held, microseconds
+    uint64_t totalHoldUs; ///< Sum of all hold times, microseconds
+} ssd1306_lock_stats_t;
+
+/// Replacement for the I2C port, see setTransport(). Receives the control
+/// byte and rows of len bytes, stride bytes apart, that make up one
+/// transaction; returns false on failure.
+typedef bool (*ssd1306_transport_t)(void *context, uint8_t control,
+                                    const uint8_t *data, uint16_t len,
+                                    uint8_t rows, uint16_t stride);
+
+/// Receives the output of writePBM() piece by piece
+typedef void (*ssd1306_writer_t)(void *context, const uint8_t *data, size_t len);
+
+/// Receives the areas sent to the display, see setMirror(). Called with
+/// len bytes of one page starting at column x, and with len 0 at the end of
+/// each update.
+typedef void (*ssd1306_mirror_t)(void *context, uint8_t page, uint8_t x,
+                                 uint8_t len, const uint8_t *data);
+
+#define SSD1306_STATS_ERRORS 4 ///< Distinct esp_err_t codes counted in stats
+
+/// Transfer counters, see getStats(). Not updated if SSD1306_NO_STATS is
+/// defined.
+typedef struct {
+    uint32_t transactions;  ///< I2C transactions issued
+    uint32_t bytes;         ///< Bytes on the wire, address and control included
+    uint32_t commandBytes;  ///< Command payload bytes
+    uint32_t dataBytes;     ///< Display RAM payload bytes
+    uint32_t links;         ///< i2c_cmd_link_create() calls
+    uint32_t failures;      ///< Transactions that did not return ESP_OK
+    esp_err_t errors[SSD1306_STATS_ERRORS]; ///< Failure codes seen, first come
+    uint32_t errorCounts[SSD1306_STATS_ERRORS]; ///< Count for each of errors[]
+    uint32_t displays;      ///< display() and displayDirty() calls
+    uint32_t lastDisplayUs; ///< Duration of the latest of those, microseconds
+    uint32_t maxDisplayUs;  ///< Longest of those, microseconds
+} ssd1306_stats_t;
 
 // Deprecated size stuff for backwards compatibility with old sketches
 #if defined SSD1306_128_64
@@ -104,11 +154,41 @@ public:
     ~Adafruit_SSD1306(void);
 
     bool begin(int8_t addr);
+    void setMux(Adafruit_SSD1306_Mux *mux, uint8_t channel);
+    Adafruit_SSD1306_Mux *getMux(void);
+    void setTransport(ssd1306_transport_t transport, void *context);
+    void setMirror(ssd1306_mirror_t mirror, void *context);
+    bool enableLocking(SemaphoreHandle_t busMutex = NULL);
+    void startWrite(void);
+    void endWrite(void);
+    void getLockStats(ssd1306_lock_stats_t *draw, ssd1306_lock_stats_t *bus);
+    void resetLockStats(void);
+    const ssd1306_stats_t *getStats(void);
+    void resetStats(void);
     void display(void);
+    void displayDirty(void);
+    bool displayDirtyPage(void);
+    bool isDirty(void);
+    void markDirty(void);
+    void markDirty(int16_t x, int16_t y, int16_t w, int16_t h);
     void clearDisplay(void);
     void invertDisplay(bool i);
     void dim(bool dim);
     void drawPixel(int16_t x, int16_t y, uint16_t color);
+    void drawRowMajorBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                            int16_t w, int16_t h, uint16_t color);
+    void drawPageBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                        int16_t w, int16_t h, uint16_t color);
+    void drawPageBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                        int16_t w, int16_t h, uint16_t color, uint16_t bg);
+    void drawRLEBitmap(int16_t x, int16_t y, const uint8_t *data, uint16_t color);
+    void drawRLEBitmap(int16_t x, int16_t y, const uint8_t *data,
+                       uint16_t color, uint16_t bg);
+    void copyRect(int16_t sx, int16_t sy, int16_t w, int16_t h, int16_t dx, int16_t dy);
+    void scrollRegion(int16_t x, int16_t y, int16_t w, int16_t h, int16_t dx, int16_t dy,
+                      uint16_t color = SSD1306_BLACK);
+    void invertRect(int16_t x, int16_t y, int16_t w, int16_t h);
+    void xorBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h);
     void startscrollright(uint8_t start, uint8_t stop);
     void startscrollleft(uint8_t start, uint8_t stop);
     void startscrolldiagright(uint8_t start, uint8_t stop);
@@ -117,6 +197,14 @@ public:
     void ssd1306_command(uint8_t c);
     bool getPixel(int16_t x, int16_t y);
     uint8_t* getBuffer(void);
+    size_t writePBM(ssd1306_writer_t writer, void *context);
+    void setGlyphCache(Adafruit_SSD1306_GlyphCache *cache);
+    size_t write(uint8_t c);
+    int16_t drawPageText(int16_t x, int16_t y, const ssd1306_font_t *font,
+                         const char *text, uint16_t color);
+    int16_t drawPageText(int16_t x, int16_t y, const ssd1306_font_t *font,
+                         const char *text, uint16_t color, uint16_t bg);
+    int16_t getPageTextWidth(const ssd1306_font_t *font, const char *text);
 
 protected:
     i2c_port_t i2c;     ///< Initialized during construction 
@@ -124,9 +212,48 @@ protected:
                         ///< begin method is called.
     uint8_t contrast;   ///< normal contrast setting for this device
     int8_t i2caddr;     ///< I2C address initialized when begin method is called.
+    uint8_t dirtyX1[SSD1306_MAX_PAGES]; ///< First changed column per page
+    uint8_t dirtyX2[SSD1306_MAX_PAGES]; ///< Last changed column per page
+    Adafruit_SSD1306_Mux *mux; ///< Multiplexer in front of the display, or NULL
+    uint8_t muxChannel; ///< Multiplexer channel the display is connected to
+    ssd1306_transport_t transport; ///< Replaces the I2C port if not NULL
+    void *transportContext;        ///< Argument for transport
+    ssd1306_mirror_t mirror;       ///< Receives copies of sent areas, or NULL
+    void *mirrorContext;           ///< Argument for mirror
+    SemaphoreHandle_t drawLock; ///< Guards buffer and dirty spans, or NULL
+    SemaphoreHandle_t busLock;  ///< Guards command/data sequences, or NULL
+    bool ownBusLock;    ///< busLock was created by enableLocking()
+    uint8_t *txBuffer;  ///< Snapshot of the area being sent when locking
+    uint8_t drawDepth;  ///< Nesting of startWrite() in the owning task
+    uint8_t busDepth;   ///< Nesting of ssd1306_lockBus() in the owning task
+    int64_t drawSince;  ///< Time the draw lock was taken
+    int64_t busSince;   ///< Time the bus lock was taken
+    ssd1306_lock_stats_t drawStats; ///< Draw lock usage
+    ssd1306_lock_stats_t busStats;  ///< Bus lock usage
+    ssd1306_stats_t stats;          ///< Transfer counters
+    Adafruit_SSD1306_GlyphCache *glyphCache; ///< Pre-rendered glyphs, or NULL
 
     void ssd1306_command1(uint8_t c);
     void ssd1306_commandList(const uint8_t *c, uint8_t n);
+    bool ssd1306_transfer(uint8_t control, const uint8_t *data, uint16_t len,
+                          uint8_t rows = 1, uint16_t stride = 0);
+    esp_err_t ssd1306_i2cWrite(uint8_t control, const uint8_t *data, uint16_t len,
+                               uint8_t rows, uint16_t stride);
+    void ssd1306_window(uint8_t x1, uint8_t x2, uint8_t page1, uint8_t page2);
+    void ssd1306_pageBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                            int16_t w, int16_t h, uint16_t color, uint16_t bg,
+                            bool opaque);
+    void ssd1306_rleBitmap(int16_t x, int16_t y, const uint8_t *data,
+                           uint16_t color, uint16_t bg, bool opaque);
+    void ssd1306_fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void ssd1306_drawChar(int16_t x, int16_t y, uint8_t c);
+    int16_t ssd1306_pageText(int16_t x, int16_t y, const ssd1306_font_t *font,
+                             const char *text, uint16_t color, uint16_t bg, bool opaque);
+    void ssd1306_lockBus(void);
+    void ssd1306_unlockBus(void);
+    void ssd1306_countError(esp_err_t err);
+    void ssd1306_countDisplay(int64_t since);
+    void ssd1306_mirrorEnd(void);
 };
 
 #endif // _Adafruit_SSD1306_H_
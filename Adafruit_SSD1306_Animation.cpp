@@ -0,0 +1,160 @@
+#include "Adafruit_SSD1306_Animation.h"
+
+/*!
+ * @file Adafruit_SSD1306_Animation.cpp
+ *
+ * Keyframe plus XOR delta animation player for SSD1306 displays.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+
+// CONSTRUCTOR -------------------------------------------------------------
+
+/*!
+    @brief  Constructor for an animation player.
+    @param  display
+            Display to draw into, started with begin().
+    @param  data
+            Animation data, the <id>_anim[] array printed by
+            scripts/make_animation.py.
+    @param  x
+            Left column of the animation on the display.
+    @param  y
+            Top row of the animation on the display, any value.
+    @return Adafruit_SSD1306_Animation object.
+*/
+Adafruit_SSD1306_Animation::Adafruit_SSD1306_Animation(Adafruit_SSD1306 *display,
+                                                       const uint8_t *data,
+                                                       int16_t x, int16_t y)
+    : display(display), data(data), x(x), y(y), loop(true)
+{
+    frames = pgm_read_byte(&data[2]) | (pgm_read_byte(&data[3]) << 8);
+    rewind();
+}
+
+
+// PLAYBACK ----------------------------------------------------------------
+
+/*!
+    @brief  Move the animation on the display.
+    @param  x
+            Left column.
+    @param  y
+            Top row.
+    @return None (void).
+    @note   Delta frames build on what the previous frame left in the
+            buffer, so this also rewinds to the first frame (a keyframe).
+*/
+void Adafruit_SSD1306_Animation::setPosition(int16_t x, int16_t y)
+{
+    this->x = x;
+    this->y = y;
+    rewind();
+}
+
+/*!
+    @brief  Choose whether step() restarts after the last frame.
+    @param  loop
+            true (default) to restart, false to stop.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Animation::setLoop(bool loop)
+{
+    this->loop = loop;
+}
+
+/*!
+    @brief  Make the first frame the next one played.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Animation::rewind(void)
+{
+    next = data + 4;
+    frame = 0;
+}
+
+/*!
+    @brief  Draw the next frame into the buffer and optionally send it.
+    @param  flush
+            true (default) to send the changes with displayDirty(), false
+            to leave that to the caller, e.g. an Adafruit_SSD1306_Manager.
+    @return true if a frame was drawn, false after the last frame when not
+            looping.
+    @note   The buffer area under the animation must not be drawn over
+            between frames: delta frames XOR their changes into what the
+            previous frame left there. Keyframes are drawn opaque.
+*/
+bool Adafruit_SSD1306_Animation::step(bool flush)
+{
+    if (frame >= frames) {
+        if (!loop || !frames) {
+            return false;
+        }
+        rewind();
+    }
+
+    display->startWrite();
+    uint8_t type = pgm_read_byte(next);
+    if (type == SSD1306_ANIM_KEYFRAME) {
+        uint16_t len = pgm_read_byte(next + 1) | (pgm_read_byte(next + 2) << 8);
+        display->drawRLEBitmap(x, y, next + 3, SSD1306_WHITE, SSD1306_BLACK);
+        next += 3 + len;
+    }
+    else {
+        // Spans of page, column, length and the bytes to flip
+        while ((type = pgm_read_byte(next++)) != SSD1306_ANIM_END) {
+            uint8_t col = pgm_read_byte(next++);
+            uint8_t len = pgm_read_byte(next++);
+            display->drawPageBitmap(x + col, y + type * 8, next, len, 8, SSD1306_INVERSE);
+            next += len;
+        }
+    }
+    frame++;
+    display->endWrite();
+
+    if (flush) {
+        display->displayDirty();
+    }
+    return true;
+}
+
+
+// ACCESSORS ---------------------------------------------------------------
+
+/*!
+    @brief  Get the index of the next frame step() will draw.
+    @return Frame index, 0 to getFrames().
+*/
+uint16_t Adafruit_SSD1306_Animation::getFrame(void)
+{
+    return frame;
+}
+
+/*!
+    @brief  Get the number of frames.
+    @return Frame count from the animation header.
+*/
+uint16_t Adafruit_SSD1306_Animation::getFrames(void)
+{
+    return frames;
+}
+
+/*!
+    @brief  Get the animation width.
+    @return Width in pixels.
+*/
+uint8_t Adafruit_SSD1306_Animation::width(void)
+{
+    return pgm_read_byte(&data[0]);
+}
+
+/*!
+    @brief  Get the animation height.
+    @return Height in pixels.
+*/
+uint8_t Adafruit_SSD1306_Animation::height(void)
+{
+    return pgm_read_byte(&data[1]);
+}
@@ -0,0 +1,54 @@
+/*!
+ * @file Adafruit_SSD1306_Animation.h
+ *
+ * Plays animations stored as keyframes plus XOR deltas of the page spans
+ * that change between frames, as produced by scripts/make_animation.py.
+ *
+ * Keyframes are run-length encoded page format images drawn with
+ * drawRLEBitmap(); delta frames XOR only their spans into the buffer and
+ * displayDirty() then sends only those, so a spinner costs a few bytes of
+ * flash and bus time per frame instead of a full 1 KB.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+#ifndef _Adafruit_SSD1306_Animation_H_
+#define _Adafruit_SSD1306_Animation_H_
+
+#include "Adafruit_SSD1306.h"
+
+#define SSD1306_ANIM_KEYFRAME 0xFE ///< Frame type byte of a keyframe
+#define SSD1306_ANIM_END 0xFF      ///< Ends the spans of a delta frame
+
+/*!
+    @brief  Animation player drawing into an Adafruit_SSD1306 buffer.
+*/
+class Adafruit_SSD1306_Animation {
+
+public:
+    Adafruit_SSD1306_Animation(Adafruit_SSD1306 *display, const uint8_t *data,
+                               int16_t x = 0, int16_t y = 0);
+
+    void setPosition(int16_t x, int16_t y);
+    void setLoop(bool loop);
+    void rewind(void);
+    bool step(bool flush = true);
+
+    uint16_t getFrame(void);
+    uint16_t getFrames(void);
+    uint8_t width(void);
+    uint8_t height(void);
+
+protected:
+    Adafruit_SSD1306 *display; ///< Display drawn into
+    const uint8_t *data;       ///< Animation data, header included
+    const uint8_t *next;       ///< Start of the next frame in data
+    int16_t x;                 ///< Left column on the display
+    int16_t y;                 ///< Top row on the display
+    uint16_t frames;           ///< Number of frames
+    uint16_t frame;            ///< Index of the next frame
+    bool loop;                 ///< Restart after the last frame
+};
+
+#endif // _Adafruit_SSD1306_Animation_H_
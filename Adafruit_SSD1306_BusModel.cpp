@@ -0,0 +1,121 @@
+#include "Adafruit_SSD1306_BusModel.h"
+
+/*!
+ * @file Adafruit_SSD1306_BusModel.cpp
+ *
+ * Wire time model of SSD1306 I2C transfers.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+#define SSD1306_BUS_WINDOW_BYTES 6 ///< PAGEADDR and COLUMNADDR with arguments
+
+/*!
+    @brief  Constructor for a bus model.
+    @param  clockHz
+            I2C clock, e.g. 100000 or 400000.
+    @param  setupUs
+            Time the driver spends per transaction besides clocking bits
+            (link setup, interrupt latency). 0 models the wire only; fit it
+            by comparing fromStats() with the measured display() time.
+    @return Adafruit_SSD1306_BusModel object.
+*/
+Adafruit_SSD1306_BusModel::Adafruit_SSD1306_BusModel(uint32_t clockHz, uint16_t setupUs)
+    : clockHz(clockHz), setupUs(setupUs)
+{
+}
+
+/*!
+    @brief  Time of a number of transactions carrying some payload.
+    @param  transactions
+            I2C transactions, each with START, address byte, control byte
+            and STOP.
+    @param  payloadBytes
+            Display RAM bytes after the control bytes, in total.
+    @param  commandBytes
+            Command bytes after the control bytes, in total, counted as
+            overhead.
+    @return Predicted time.
+*/
+ssd1306_bus_time_t Adafruit_SSD1306_BusModel::transfer(uint32_t transactions,
+                                                       uint32_t payloadBytes,
+                                                       uint32_t commandBytes)
+{
+    ssd1306_bus_time_t t;
+    uint64_t framingBits = (uint64_t)transactions
+                           * (SSD1306_BUS_FRAMING_BITS + 2 * SSD1306_BUS_BITS_PER_BYTE)
+                           + (uint64_t)commandBytes * SSD1306_BUS_BITS_PER_BYTE;
+
+    t.payloadUs = ssd1306_bitsToUs((uint64_t)payloadBytes * SSD1306_BUS_BITS_PER_BYTE);
+    t.overheadUs = ssd1306_bitsToUs(framingBits) + transactions * setupUs;
+    t.totalUs = t.payloadUs + t.overheadUs;
+    return t;
+}
+
+/*!
+    @brief  Time of a full display() update.
+    @param  w
+            Display width in pixels.
+    @param  h
+            Display height in pixels.
+    @return Predicted time.
+*/
+ssd1306_bus_time_t Adafruit_SSD1306_BusModel::display(uint8_t w, uint8_t h)
+{
+    return window(w, (h + 7) / 8);
+}
+
+/*!
+    @brief  Time of a partial update of one address window, as sent by
+            displayDirty() for each run of changed pages.
+    @param  columns
+            Window width in columns.
+    @param  pages
+            Window height in pages of 8 rows.
+    @return Predicted time.
+*/
+ssd1306_bus_time_t Adafruit_SSD1306_BusModel::window(uint8_t columns, uint8_t pages)
+{
+    // One command transaction for the window, one data transaction
+    return transfer(2, (uint32_t)columns * pages, SSD1306_BUS_WINDOW_BYTES);
+}
+
+/*!
+    @brief  Time of the traffic recorded in a display's counters, to be
+            compared with the measured time.
+    @param  stats
+            Counters from Adafruit_SSD1306::getStats().
+    @return Predicted time for all recorded transactions.
+*/
+ssd1306_bus_time_t Adafruit_SSD1306_BusModel::fromStats(const ssd1306_stats_t *stats)
+{
+    return transfer(stats->transactions, stats->dataBytes, stats->commandBytes);
+}
+
+/*!
+    @brief  Upper bound of the frame rate with full display() updates.
+    @param  w
+            Display width in pixels.
+    @param  h
+            Display height in pixels.
+    @return Frames per second if the bus did nothing else.
+*/
+uint32_t Adafruit_SSD1306_BusModel::maxFps(uint8_t w, uint8_t h)
+{
+    uint32_t us = display(w, h).totalUs;
+    return us ? 1000000UL / us : 0;
+}
+
+
+/*!
+    @brief  Wire time of a number of bit periods at the model's clock.
+    @param  bits
+            SCL periods.
+    @return Time in microseconds, rounded down.
+    @note   This is a protected function, not exposed.
+*/
+uint32_t Adafruit_SSD1306_BusModel::ssd1306_bitsToUs(uint64_t bits)
+{
+    return (uint32_t)(bits * 1000000UL / clockHz);
+}
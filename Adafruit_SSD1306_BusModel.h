@@ -0,0 +1,49 @@
+/*!
+ * @file Adafruit_SSD1306_BusModel.h
+ *
+ * Wire time model of SSD1306 I2C transfers, to predict the frame rate of a
+ * configuration and to split measured traffic into pixel payload and
+ * protocol overhead.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+#ifndef _Adafruit_SSD1306_BusModel_H_
+#define _Adafruit_SSD1306_BusModel_H_
+
+#include "Adafruit_SSD1306.h"
+
+#define SSD1306_BUS_BITS_PER_BYTE 9 ///< 8 data bits and the ACK bit
+#define SSD1306_BUS_FRAMING_BITS 2  ///< START and STOP, about a bit time each
+
+/// Predicted wire time, in microseconds
+typedef struct {
+    uint32_t totalUs;    ///< Everything
+    uint32_t payloadUs;  ///< Pixel bytes
+    uint32_t overheadUs; ///< START/STOP, address, control and command bytes, setup
+} ssd1306_bus_time_t;
+
+/*!
+    @brief  Computes the time SSD1306 transfers take on an I2C bus.
+*/
+class Adafruit_SSD1306_BusModel {
+
+public:
+    Adafruit_SSD1306_BusModel(uint32_t clockHz = 400000, uint16_t setupUs = 0);
+
+    ssd1306_bus_time_t transfer(uint32_t transactions, uint32_t payloadBytes,
+                                uint32_t commandBytes = 0);
+    ssd1306_bus_time_t display(uint8_t w, uint8_t h);
+    ssd1306_bus_time_t window(uint8_t columns, uint8_t pages);
+    ssd1306_bus_time_t fromStats(const ssd1306_stats_t *stats);
+    uint32_t maxFps(uint8_t w, uint8_t h);
+
+protected:
+    uint32_t clockHz; ///< I2C clock
+    uint16_t setupUs; ///< Driver time per transaction outside the wire
+
+    uint32_t ssd1306_bitsToUs(uint64_t bits);
+};
+
+#endif // _Adafruit_SSD1306_BusModel_H_
@@ -0,0 +1,227 @@
+#include "Adafruit_SSD1306_Chart.h"
+#include <string.h>
+
+/*!
+ * @file Adafruit_SSD1306_Chart.cpp
+ *
+ * Strip chart with column-shift rendering for SSD1306 displays.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+
+// CONSTRUCTOR -------------------------------------------------------------
+
+/*!
+    @brief  Constructor for a strip chart. Nothing is drawn until the first
+            sample; call clear() to blank the area first.
+    @param  display
+            Display to draw into, started with begin().
+    @param  x
+            Left column of the chart.
+    @param  page
+            Top page of the chart, it starts at row page * 8.
+    @param  w
+            Width in columns, the number of samples shown.
+    @param  pages
+            Height in pages of 8 rows.
+    @param  min
+            Sample value drawn on the bottom row.
+    @param  max
+            Sample value drawn on the top row.
+    @return Adafruit_SSD1306_Chart object.
+    @note   Coordinates are buffer coordinates, i.e. rotation 0, whatever
+            the rotation set with setRotation(). The plot is kept only in
+            the buffer, so columns right of the display edge scroll in
+            blank.
+*/
+Adafruit_SSD1306_Chart::Adafruit_SSD1306_Chart(Adafruit_SSD1306 *display, int16_t x, uint8_t page,
+                                               int16_t w, uint8_t pages, int32_t min, int32_t max)
+    : display(display), x(x), page(page), w(w), pages(pages), min(min), max(max),
+      style(SSD1306_CHART_LINE), color(SSD1306_WHITE), bg(SSD1306_BLACK), last(-1)
+{
+}
+
+
+// SETTINGS ----------------------------------------------------------------
+
+/*!
+    @brief  Change the value range. Samples already plotted keep their
+            position.
+    @param  min
+            Sample value drawn on the bottom row.
+    @param  max
+            Sample value drawn on the top row.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Chart::setRange(int32_t min, int32_t max)
+{
+    this->min = min;
+    this->max = max;
+    last = -1;
+}
+
+/*!
+    @brief  Set how samples are drawn, from the next one on.
+    @param  style
+            SSD1306_CHART_LINE (default), SSD1306_CHART_DOTS or
+            SSD1306_CHART_BARS.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Chart::setStyle(uint8_t style)
+{
+    this->style = style;
+}
+
+/*!
+    @brief  Set the colors, from the next sample on.
+    @param  color
+            Plot color, SSD1306_WHITE (default) or SSD1306_BLACK.
+    @param  bg
+            Background color, SSD1306_BLACK (default) or SSD1306_WHITE.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Chart::setColor(uint16_t color, uint16_t bg)
+{
+    this->color = color;
+    this->bg = bg;
+}
+
+
+// PLOTTING ----------------------------------------------------------------
+
+/*!
+    @brief  Fill the chart with the background color and forget the
+            previous sample.
+    @param  flush
+            true (default) to send the chart with displayDirty().
+    @return None (void).
+*/
+void Adafruit_SSD1306_Chart::clear(bool flush)
+{
+    // Shifting by the full width uncovers the whole area
+    display->startWrite();
+    shift(w);
+    display->endWrite();
+    last = -1;
+    if (flush) {
+        display->displayDirty();
+    }
+}
+
+/*!
+    @brief  Scroll the chart left by one column and plot a sample in the
+            rightmost one.
+    @param  value
+            Sample, clamped to the range.
+    @param  flush
+            true (default) to send the chart with displayDirty(), false to
+            leave that to the caller, e.g. to batch several widgets.
+    @return None (void).
+    @note   The cost does not depend on the width: one memmove() per page
+            of the chart and one byte per page for the new column.
+*/
+void Adafruit_SSD1306_Chart::addSample(int32_t value, bool flush)
+{
+    int16_t r = row(value);
+    int16_t r1 = r, r2 = r;
+
+    if (style == SSD1306_CHART_BARS) {
+        r2 = pages * 8 - 1;
+    }
+    else if ((style == SSD1306_CHART_LINE) && (last >= 0)) {
+        r1 = (last < r) ? last + 1 : r;
+        r2 = (last > r) ? last - 1 : r;
+    }
+    last = r;
+
+    display->startWrite();
+    shift(1);
+    drawColumn(r1, r2);
+    display->endWrite();
+    if (flush) {
+        display->displayDirty();
+    }
+}
+
+/*!
+    @brief  Map a sample to a chart row.
+    @param  value
+            Sample.
+    @return Row from the top of the chart, clamped to the chart.
+*/
+int16_t Adafruit_SSD1306_Chart::row(int32_t value)
+{
+    int16_t h = pages * 8;
+    if ((max == min) || (value <= min)) {
+        return h - 1;
+    }
+    if (value >= max) {
+        return 0;
+    }
+    return h - 1 - (int16_t)(((int64_t)value - min) * (h - 1) / ((int64_t)max - min));
+}
+
+/*!
+    @brief  Shift the chart left in the buffer, filling the uncovered
+            columns on the right with the background color.
+    @param  n
+            Number of columns, from 1 to the chart width.
+    @return None (void).
+    @note   Works on buffer bytes like drawColumn(), so both agree on the
+            chart position under any rotation.
+*/
+void Adafruit_SSD1306_Chart::shift(int16_t n)
+{
+    uint8_t *buffer = display->getBuffer();
+    int16_t width = (display->getRotation() & 1) ? display->height() : display->width();
+    int16_t height = (display->getRotation() & 1) ? display->width() : display->height();
+    int16_t x1 = (x < 0) ? 0 : x;
+    int16_t x2 = (x + w > width) ? width : x + w;
+    int16_t keep = x2 - x1 - n;
+
+    if (x1 >= x2) {
+        return;
+    }
+    if (keep < 0) {
+        keep = 0;
+    }
+    for (uint8_t p = 0; (p < pages) && (page + p < (height + 7) / 8); p++) {
+        uint8_t *row = &buffer[(page + p) * width];
+        memmove(&row[x1], &row[x1 + n], keep);
+        memset(&row[x1 + keep], bg ? 0xFF : 0x00, x2 - x1 - keep);
+    }
+    display->markDirty(x1, page * 8, x2 - x1, pages * 8);
+}
+
+/*!
+    @brief  Draw the rightmost column: rows r1 to r2 in the plot color, the
+            rest in the background color, a byte per page.
+    @param  r1
+            First plot row, from the top of the chart.
+    @param  r2
+            Last plot row.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Chart::drawColumn(int16_t r1, int16_t r2)
+{
+    uint8_t *buffer = display->getBuffer();
+    int16_t width = (display->getRotation() & 1) ? display->height() : display->width();
+    int16_t height = (display->getRotation() & 1) ? display->width() : display->height();
+    int16_t cx = x + w - 1;
+
+    if ((cx < 0) || (cx >= width) || (w <= 0)) {
+        return;
+    }
+    for (uint8_t p = 0; (p < pages) && (page + p < (height + 7) / 8); p++) {
+        // Rows r1..r2 that fall in this page
+        int16_t a = r1 - p * 8;
+        int16_t b = r2 - p * 8;
+        uint8_t bits = 0;
+        if ((a < 8) && (b >= 0)) {
+            bits = (uint8_t)(0xFF << ((a > 0) ? a : 0)) & (0xFF >> ((b < 7) ? 7 - b : 0));
+        }
+        buffer[(page + p) * width + cx] = (color ? bits : 0) | (bg ? (uint8_t)~bits : 0);
+    }
+}
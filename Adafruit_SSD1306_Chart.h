@@ -0,0 +1,56 @@
+/*!
+ * @file Adafruit_SSD1306_Chart.h
+ *
+ * Strip chart widget for an Adafruit_SSD1306 buffer.
+ *
+ * The plot stays in the buffer: each sample shifts it left by one column,
+ * a memmove() per page of buffer bytes, and only the new column is drawn.
+ * displayDirty() then sends just the pages of the chart.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+#ifndef _Adafruit_SSD1306_Chart_H_
+#define _Adafruit_SSD1306_Chart_H_
+
+#include "Adafruit_SSD1306.h"
+
+#define SSD1306_CHART_LINE 0 ///< Join each sample to the previous one
+#define SSD1306_CHART_DOTS 1 ///< One pixel per sample
+#define SSD1306_CHART_BARS 2 ///< Fill from the sample down to the bottom
+
+/*!
+    @brief  Scrolling strip chart drawn into an Adafruit_SSD1306 buffer.
+*/
+class Adafruit_SSD1306_Chart {
+
+public:
+    Adafruit_SSD1306_Chart(Adafruit_SSD1306 *display, int16_t x, uint8_t page,
+                           int16_t w, uint8_t pages, int32_t min, int32_t max);
+
+    void setRange(int32_t min, int32_t max);
+    void setStyle(uint8_t style);
+    void setColor(uint16_t color, uint16_t bg);
+    void clear(bool flush = true);
+    void addSample(int32_t value, bool flush = true);
+
+protected:
+    Adafruit_SSD1306 *display; ///< Display drawn into
+    int16_t x;                 ///< Left column
+    uint8_t page;              ///< Top page
+    int16_t w;                 ///< Width in columns, one sample each
+    uint8_t pages;             ///< Height in pages
+    int32_t min;               ///< Value at the bottom row
+    int32_t max;               ///< Value at the top row
+    uint8_t style;             ///< SSD1306_CHART_LINE, _DOTS or _BARS
+    uint16_t color;            ///< Plot color
+    uint16_t bg;               ///< Background color
+    int16_t last;              ///< Row of the previous sample, -1 if none
+
+    int16_t row(int32_t value);
+    void shift(int16_t n);
+    void drawColumn(int16_t r1, int16_t r2);
+};
+
+#endif // _Adafruit_SSD1306_Chart_H_
@@ -0,0 +1,550 @@
+#include "Adafruit_SSD1306_Emulator.h"
+#include <stdio.h>
+#include <string.h>
+
+/*!
+ * @file Adafruit_SSD1306_Emulator.cpp
+ *
+ * Software model of an SSD1306 controller, for testing and benchmarking
+ * the library without hardware.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+#define SSD1306_EMU_CO 0x80 ///< Control byte: another control byte follows
+#define SSD1306_EMU_DC 0x40 ///< Control byte: GDDRAM data, not commands
+
+
+// CONSTRUCTOR -------------------------------------------------------------
+
+/*!
+    @brief  Constructor for an emulated display.
+    @param  w
+            Panel width in pixels, up to 128.
+    @param  h
+            Panel height in pixels, up to 64.
+    @return Adafruit_SSD1306_Emulator object, in power-on state.
+*/
+Adafruit_SSD1306_Emulator::Adafruit_SSD1306_Emulator(uint8_t w, uint8_t h)
+    : width(w), height(h)
+{
+    reset();
+}
+
+/*!
+    @brief  Return to the power-on state: page addressing, no remap,
+            display off, GDDRAM cleared, counters zeroed.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Emulator::reset(void)
+{
+    memset(ram, 0, sizeof(ram));
+    cmdLen = cmdNeed = 0;
+    memoryMode = 2;
+    colStart = col = 0;
+    colEnd = SSD1306_EMU_COLUMNS - 1;
+    pageStart = page = 0;
+    pageEnd = SSD1306_EMU_PAGES - 1;
+    startLine = offset = 0;
+    multiplex = 63;
+    segRemap = comScanDec = inverted = allOn = displayOn = false;
+    contrast = 0x7F;
+    scrolling = false;
+    scrollCmd = scrollStart = scrollEnd = scrollVertical = 0;
+    scrollTop = 0;
+    scrollRows = 64;
+    resetCounters();
+}
+
+
+// BUS SIDE ----------------------------------------------------------------
+
+/*!
+    @brief  Receive one transaction, as sent by the library.
+    @param  control
+            Control byte following the address.
+    @param  data
+            Bytes following the control byte.
+    @param  len
+            Number of bytes in data.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Emulator::write(uint8_t control, const uint8_t *data, size_t len)
+{
+    counters.transactions++;
+    counters.bytes += len + 2;
+    stream(control, data, len);
+}
+
+/*!
+    @brief  Receive one raw transaction: every byte after the address byte,
+            starting with a control byte.
+    @param  bytes
+            Transaction bytes.
+    @param  len
+            Number of bytes.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Emulator::feed(const uint8_t *bytes, size_t len)
+{
+    if (!len) {
+        return;
+    }
+    counters.transactions++;
+    counters.bytes += len + 1;
+    stream(bytes[0], bytes + 1, len - 1);
+}
+
+/*!
+    @brief  Transport function for Adafruit_SSD1306::setTransport().
+    @param  context
+            The Adafruit_SSD1306_Emulator receiving the traffic.
+    @param  control
+            Control byte of the transaction.
+    @param  data
+            First byte of the transaction.
+    @param  len
+            Bytes per row.
+    @param  rows
+            Number of rows.
+    @param  stride
+            Distance between the start of consecutive rows.
+    @return true, the emulator never fails a transaction.
+*/
+bool Adafruit_SSD1306_Emulator::transport(void *context, uint8_t control,
+                                          const uint8_t *data, uint16_t len,
+                                          uint8_t rows, uint16_t stride)
+{
+    Adafruit_SSD1306_Emulator *self = (Adafruit_SSD1306_Emulator *)context;
+
+    self->counters.transactions++;
+    self->counters.bytes += (uint32_t)len * rows + 2;
+    for (uint8_t i = 0; i < rows; i++) {
+        self->stream(control, data + i * stride, len);
+    }
+    return true;
+}
+
+/*!
+    @brief  Route the bytes of a transaction to the command parser or the
+            GDDRAM according to the control byte(s).
+    @param  control
+            Control byte preceding data.
+    @param  data
+            Bytes following the control byte.
+    @param  len
+            Number of bytes.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Emulator::stream(uint8_t control, const uint8_t *data, size_t len)
+{
+    // With Co set, a single byte is followed by a new control byte
+    while ((control & SSD1306_EMU_CO) && len) {
+        if (control & SSD1306_EMU_DC) {
+            this->data(*data++);
+        }
+        else {
+            command(*data++);
+        }
+        if (!--len) {
+            return;
+        }
+        control = *data++;
+        len--;
+    }
+    while (len--) {
+        if (control & SSD1306_EMU_DC) {
+            this->data(*data++);
+        }
+        else {
+            command(*data++);
+        }
+    }
+}
+
+
+// CONTROLLER --------------------------------------------------------------
+
+/*!
+    @brief  Number of argument bytes following a command byte.
+    @param  c
+            Command byte.
+    @return Argument count.
+*/
+static uint8_t ssd1306_emu_args(uint8_t c)
+{
+    switch (c) {
+    case 0x20: // Memory addressing mode
+    case 0x81: // Contrast
+    case 0x8D: // Charge pump
+    case 0xA8: // Multiplex ratio
+    case 0xD3: // Display offset
+    case 0xD5: // Clock divide
+    case 0xD9: // Pre-charge period
+    case 0xDA: // COM pins
+    case 0xDB: // VCOMH deselect level
+        return 1;
+    case 0x21: // Column address
+    case 0x22: // Page address
+    case 0xA3: // Vertical scroll area
+        return 2;
+    case 0x29: // Vertical and right horizontal scroll
+    case 0x2A: // Vertical and left horizontal scroll
+        return 5;
+    case 0x26: // Right horizontal scroll
+    case 0x27: // Left horizontal scroll
+        return 6;
+    }
+    return 0;
+}
+
+/*!
+    @brief  Accept one command or argument byte.
+    @param  c
+            Byte received with D/C# low.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Emulator::command(uint8_t c)
+{
+    counters.commandBytes++;
+    if (cmdLen == 0) {
+        cmdNeed = ssd1306_emu_args(c) + 1;
+    }
+    cmd[cmdLen++] = c;
+    if (cmdLen == cmdNeed) {
+        execute();
+        cmdLen = 0;
+    }
+}
+
+/*!
+    @brief  Apply the complete command held in cmd[].
+    @return None (void).
+*/
+void Adafruit_SSD1306_Emulator::execute(void)
+{
+    uint8_t c = cmd[0];
+
+    if (c <= 0x0F) { // Lower column nibble, page addressing
+        col = (col & 0xF0) | (c & 0x0F);
+        return;
+    }
+    if (c <= 0x1F) { // Higher column nibble, page addressing
+        col = (col & 0x0F) | ((c & 0x07) << 4);
+        return;
+    }
+    if ((c >= 0x40) && (c <= 0x7F)) {
+        startLine = c & 0x3F;
+        return;
+    }
+    if ((c >= 0xB0) && (c <= 0xB7)) { // Page start, page addressing
+        page = c & 0x07;
+        return;
+    }
+
+    switch (c) {
+    case 0x20:
+        memoryMode = (cmd[1] & 0x03) == 0x03 ? 2 : (cmd[1] & 0x03);
+        break;
+    case 0x21:
+        col = colStart = cmd[1] & 0x7F;
+        colEnd = cmd[2] & 0x7F;
+        break;
+    case 0x22:
+        page = pageStart = cmd[1] & 0x07;
+        pageEnd = cmd[2] & 0x07;
+        break;
+    case 0x26:
+    case 0x27:
+    case 0x29:
+    case 0x2A:
+        scrollCmd = c;
+        scrollStart = cmd[2] & 0x07;
+        scrollEnd = cmd[4] & 0x07;
+        scrollVertical = (c >= 0x29) ? (cmd[5] & 0x3F) : 0;
+        break;
+    case 0x2E:
+        scrolling = false;
+        break;
+    case 0x2F:
+        scrolling = true;
+        break;
+    case 0x81:
+        contrast = cmd[1];
+        break;
+    case 0xA0:
+    case 0xA1:
+        segRemap = c & 0x01;
+        break;
+    case 0xA3:
+        scrollTop = cmd[1] & 0x3F;
+        scrollRows = cmd[2] & 0x7F;
+        break;
+    case 0xA4:
+    case 0xA5:
+        allOn = c & 0x01;
+        break;
+    case 0xA6:
+    case 0xA7:
+        inverted = c & 0x01;
+        break;
+    case 0xA8:
+        multiplex = cmd[1] & 0x3F;
+        break;
+    case 0xAE:
+    case 0xAF:
+        displayOn = c & 0x01;
+        break;
+    case 0xC0:
+    case 0xC8:
+        comScanDec = c & 0x08;
+        break;
+    case 0xD3:
+        offset = cmd[1] & 0x3F;
+        break;
+    case 0x8D: // Power and timing settings do not affect the image
+    case 0xD5:
+    case 0xD9:
+    case 0xDA:
+    case 0xDB:
+    case 0xE3: // NOP
+        break;
+    default:
+        counters.unknownCommands++;
+        break;
+    }
+}
+
+/*!
+    @brief  Store one GDDRAM byte and advance the address pointer as the
+            current addressing mode does.
+    @param  d
+            Byte received with D/C# high.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Emulator::data(uint8_t d)
+{
+    counters.dataBytes++;
+    ram[page * SSD1306_EMU_COLUMNS + col] = d;
+
+    switch (memoryMode) {
+    case 0: // Horizontal
+        if (col >= colEnd) {
+            col = colStart;
+            page = (page >= pageEnd) ? pageStart : page + 1;
+        }
+        else {
+            col++;
+        }
+        break;
+    case 1: // Vertical
+        if (page >= pageEnd) {
+            page = pageStart;
+            col = (col >= colEnd) ? colStart : col + 1;
+        }
+        else {
+            page++;
+        }
+        break;
+    default: // Page
+        col = (col + 1) & (SSD1306_EMU_COLUMNS - 1);
+        break;
+    }
+}
+
+/*!
+    @brief  Advance an active scroll by one step: the scrolled pages rotate
+            by one column, and a diagonal scroll also moves the start line
+            by its vertical offset.
+    @return None (void).
+    @note   The real controller steps on its own at the programmed frame
+            interval; tests call this to emulate the passing of one
+            interval.
+*/
+void Adafruit_SSD1306_Emulator::scrollStep(void)
+{
+    if (!scrolling) {
+        return;
+    }
+    bool right = (scrollCmd == 0x26) || (scrollCmd == 0x29);
+
+    for (uint8_t p = scrollStart; p <= scrollEnd; p++) {
+        uint8_t *row = ram + p * SSD1306_EMU_COLUMNS;
+        if (right) {
+            uint8_t last = row[SSD1306_EMU_COLUMNS - 1];
+            memmove(row + 1, row, SSD1306_EMU_COLUMNS - 1);
+            row[0] = last;
+        }
+        else {
+            uint8_t first = row[0];
+            memmove(row, row + 1, SSD1306_EMU_COLUMNS - 1);
+            row[SSD1306_EMU_COLUMNS - 1] = first;
+        }
+    }
+    if (scrollVertical) {
+        startLine = (startLine + scrollVertical) & 0x3F;
+    }
+}
+
+
+// PANEL SIDE --------------------------------------------------------------
+
+/*!
+    @brief  Get a pixel as the panel shows it.
+    @param  x
+            Column, 0 at left.
+    @param  y
+            Row, 0 at top.
+    @return true if the pixel is lit.
+    @note   The panel is wired like Adafruit's modules: with the segment
+            remap and COM scan direction the library's begin() sets,
+            pixel (x, y) of the library buffer shows at (x, y). Start line,
+            display offset, multiplex ratio, invert and display on/off are
+            applied.
+*/
+bool Adafruit_SSD1306_Emulator::getPixel(int16_t x, int16_t y)
+{
+    if ((x < 0) || (x >= width) || (y < 0) || (y >= height) || (y > multiplex)) {
+        return false;
+    }
+    if (!displayOn) {
+        return false;
+    }
+    if (allOn) {
+        return true;
+    }
+    uint8_t com = comScanDec ? y : (multiplex - y);
+    uint8_t row = (com + offset + startLine) & 0x3F;
+    uint8_t column = segRemap ? x : (SSD1306_EMU_COLUMNS - 1 - x);
+    bool lit = (ram[(row / 8) * SSD1306_EMU_COLUMNS + column] >> (row & 7)) & 1;
+    return lit != inverted;
+}
+
+/*!
+    @brief  Dump the panel, as getPixel() sees it, as a PBM image.
+    @param  writer
+            Function receiving the image bytes.
+    @param  context
+            Passed unchanged to writer.
+    @param  name
+            Optional name, stored as a comment in the header so several
+            images can be told apart in one capture.
+    @param  ascii
+            true for plain PBM (P1), one text line per row, convenient over
+            a serial console; false for packed binary PBM (P4).
+    @return Number of bytes written.
+*/
+size_t Adafruit_SSD1306_Emulator::writePBM(ssd1306_emu_writer_t writer, void *context,
+                                           const char *name, bool ascii)
+{
+    char header[80];
+    uint8_t row[SSD1306_EMU_COLUMNS + 1];
+    size_t total = 0;
+
+    int n = snprintf(header, sizeof(header), "%s\n%s%.60s%s%u %u\n",
+                     ascii ? "P1" : "P4", name ? "# " : "", name ? name : "",
+                     name ? "\n" : "", width, height);
+    writer(context, (const uint8_t *)header, n);
+    total += n;
+
+    for (int16_t y = 0; y < height; y++) {
+        size_t len;
+        if (ascii) {
+            for (int16_t x = 0; x < width; x++) {
+                row[x] = getPixel(x, y) ? '1' : '0';
+            }
+            row[width] = '\n';
+            len = width + 1;
+        }
+        else {
+            len = (width + 7) / 8;
+            memset(row, 0, len);
+            for (int16_t x = 0; x < width; x++) {
+                if (getPixel(x, y)) {
+                    row[x / 8] |= 0x80 >> (x & 7);
+                }
+            }
+        }
+        writer(context, row, len);
+        total += len;
+    }
+    return total;
+}
+
+/*!
+    @brief  Get the emulated GDDRAM.
+    @return 8 pages of 128 bytes, in the same layout as the library buffer
+            of a 128x64 display.
+*/
+const uint8_t *Adafruit_SSD1306_Emulator::getRAM(void)
+{
+    return ram;
+}
+
+/*!
+    @brief  Check whether the panel is on.
+    @return true after DISPLAYON, false after DISPLAYOFF or reset.
+*/
+bool Adafruit_SSD1306_Emulator::isDisplayOn(void)
+{
+    return displayOn;
+}
+
+/*!
+    @brief  Check whether inverse display is selected.
+    @return true after INVERTDISPLAY.
+*/
+bool Adafruit_SSD1306_Emulator::isInverted(void)
+{
+    return inverted;
+}
+
+/*!
+    @brief  Check whether a scroll is active.
+    @return true between ACTIVATE_SCROLL and DEACTIVATE_SCROLL.
+*/
+bool Adafruit_SSD1306_Emulator::isScrolling(void)
+{
+    return scrolling;
+}
+
+/*!
+    @brief  Get the contrast setting.
+    @return Last SETCONTRAST value, 0x7F after reset.
+*/
+uint8_t Adafruit_SSD1306_Emulator::getContrast(void)
+{
+    return contrast;
+}
+
+/*!
+    @brief  Get the display start line.
+    @return RAM row shown on the first COM line, 0 to 63.
+*/
+uint8_t Adafruit_SSD1306_Emulator::getStartLine(void)
+{
+    return startLine;
+}
+
+
+// COUNTERS ----------------------------------------------------------------
+
+/*!
+    @brief  Get the traffic counters, e.g. to measure bytes on the wire
+            per frame.
+    @return Pointer to the counters, updated in place.
+*/
+const ssd1306_emu_counters_t *Adafruit_SSD1306_Emulator::getCounters(void)
+{
+    return &counters;
+}
+
+/*!
+    @brief  Zero the traffic counters.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Emulator::resetCounters(void)
+{
+    memset(&counters, 0, sizeof(counters));
+}
@@ -0,0 +1,112 @@
+/*!
+ * @file Adafruit_SSD1306_Emulator.h
+ *
+ * Software model of an SSD1306 controller, for testing and benchmarking
+ * the library without hardware.
+ *
+ * It interprets the command and data byte stream the driver sends --
+ * addressing modes and windows, start line, display offset, segment
+ * remap, COM scan direction, invert, contrast and scroll setup -- into an
+ * emulated 128x64 GDDRAM, and counts the bytes that would be on the wire.
+ * It has no ESP-IDF or Adafruit_GFX dependency and builds on any host.
+ * writePBM() dumps the panel as a PBM image for comparison against golden
+ * images, see scripts/pbm_compare.py.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+#ifndef _Adafruit_SSD1306_Emulator_H_
+#define _Adafruit_SSD1306_Emulator_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SSD1306_EMU_COLUMNS 128 ///< GDDRAM columns
+#define SSD1306_EMU_PAGES 8     ///< GDDRAM pages of 8 rows
+
+/// Traffic seen by the emulator since the last resetCounters()
+typedef struct {
+    uint32_t transactions;  ///< Transactions received
+    uint32_t bytes;         ///< Bytes on the wire, address and control included
+    uint32_t commandBytes;  ///< Command and argument bytes
+    uint32_t dataBytes;     ///< GDDRAM bytes written
+    uint32_t unknownCommands; ///< Command bytes the emulator does not model
+} ssd1306_emu_counters_t;
+
+/// Receives the output of writePBM() piece by piece
+typedef void (*ssd1306_emu_writer_t)(void *context, const uint8_t *data, size_t len);
+
+/*!
+    @brief  Emulated SSD1306 controller and panel.
+*/
+class Adafruit_SSD1306_Emulator {
+
+public:
+    Adafruit_SSD1306_Emulator(uint8_t w = 128, uint8_t h = 64);
+
+    void reset(void);
+    void write(uint8_t control, const uint8_t *data, size_t len);
+    void feed(const uint8_t *bytes, size_t len);
+    static bool transport(void *context, uint8_t control, const uint8_t *data,
+                          uint16_t len, uint8_t rows, uint16_t stride);
+
+    bool getPixel(int16_t x, int16_t y);
+    const uint8_t *getRAM(void);
+    void scrollStep(void);
+    size_t writePBM(ssd1306_emu_writer_t writer, void *context,
+                    const char *name = NULL, bool ascii = false);
+
+    bool isDisplayOn(void);
+    bool isInverted(void);
+    bool isScrolling(void);
+    uint8_t getContrast(void);
+    uint8_t getStartLine(void);
+
+    const ssd1306_emu_counters_t *getCounters(void);
+    void resetCounters(void);
+
+protected:
+    uint8_t width;          ///< Panel width in pixels
+    uint8_t height;         ///< Panel height in pixels
+    uint8_t ram[SSD1306_EMU_PAGES * SSD1306_EMU_COLUMNS]; ///< GDDRAM, page-major
+
+    uint8_t cmd[7];         ///< Command being received and its arguments
+    uint8_t cmdLen;         ///< Bytes of cmd received so far
+    uint8_t cmdNeed;        ///< Bytes cmd needs in total
+
+    uint8_t memoryMode;     ///< 0 horizontal, 1 vertical, 2 page addressing
+    uint8_t colStart;       ///< Column window start
+    uint8_t colEnd;         ///< Column window end
+    uint8_t pageStart;      ///< Page window start
+    uint8_t pageEnd;        ///< Page window end
+    uint8_t col;            ///< Column pointer
+    uint8_t page;           ///< Page pointer
+
+    uint8_t startLine;      ///< RAM row shown on the first COM line
+    uint8_t offset;         ///< Display offset (vertical COM shift)
+    uint8_t multiplex;      ///< Multiplex ratio, rows driven minus one
+    bool segRemap;          ///< Column address 127 mapped to SEG0
+    bool comScanDec;        ///< COM scanned from COM[N-1] to COM0
+    bool inverted;          ///< Inverse display
+    bool allOn;             ///< Entire display on, ignoring RAM
+    bool displayOn;         ///< Panel powered on
+    uint8_t contrast;       ///< Contrast setting
+
+    bool scrolling;         ///< Scroll activated
+    uint8_t scrollCmd;      ///< Scroll setup command, 0x26/0x27/0x29/0x2A
+    uint8_t scrollStart;    ///< First scrolled page
+    uint8_t scrollEnd;      ///< Last scrolled page
+    uint8_t scrollVertical; ///< Rows per step of a diagonal scroll
+    uint8_t scrollTop;      ///< Vertical scroll area: fixed rows on top
+    uint8_t scrollRows;     ///< Vertical scroll area: rows that scroll
+
+    ssd1306_emu_counters_t counters; ///< Traffic counters
+
+    void stream(uint8_t control, const uint8_t *data, size_t len);
+    void command(uint8_t c);
+    void execute(void);
+    void data(uint8_t d);
+};
+
+#endif // _Adafruit_SSD1306_Emulator_H_
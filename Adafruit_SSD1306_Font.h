@@ -0,0 +1,58 @@
+/*!
+ * @file Adafruit_SSD1306_Font.h
+ *
+ * Page format font structures, as produced by scripts/make_font.py from
+ * Adafruit_GFX fonts or BDF files and drawn by drawPageText().
+ *
+ * Every glyph covers the full font height, ascent plus descent, so a glyph
+ * is a drawPageBitmap() image of its ink columns and text drawn at a row
+ * that is a multiple of 8 lands on whole buffer bytes.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+#ifndef _Adafruit_SSD1306_Font_H_
+#define _Adafruit_SSD1306_Font_H_
+
+#include <stdint.h>
+
+// Fonts live in PROGMEM, so their pointers are read with pgm_read_pointer()
+// like the GFXfont ones in Adafruit_GFX: 16 bits on AVR, 32 elsewhere
+#ifndef pgm_read_pointer
+#if !defined(__INT_MAX__) || (__INT_MAX__ > 0xFFFF)
+#define pgm_read_pointer(addr) ((void *)pgm_read_dword(addr))
+#else
+#define pgm_read_pointer(addr) ((void *)pgm_read_word(addr))
+#endif
+#endif
+
+/// One glyph of a page format font
+typedef struct {
+    uint16_t offset; ///< First byte of the glyph in the font bitmap
+    uint8_t width;   ///< Ink columns in the bitmap, 0 for blank glyphs
+    uint8_t advance; ///< Cursor advance in pixels
+    int8_t xOffset;  ///< First ink column relative to the cursor
+} ssd1306_font_glyph_t;
+
+/// Kerning pair, applied to the advance of the left character
+typedef struct {
+    uint8_t left;   ///< Left character
+    uint8_t right;  ///< Right character
+    int8_t adjust;  ///< Pixels added to the advance of left
+} ssd1306_font_kern_t;
+
+/// Page format font
+typedef struct {
+    const uint8_t *bitmap;              ///< Glyphs, width * ((height + 7) / 8) bytes each
+    const ssd1306_font_glyph_t *glyphs; ///< Glyphs first to last
+    const ssd1306_font_kern_t *kerning; ///< Pairs sorted by left then right, or NULL
+    uint16_t kerningCount;              ///< Number of kerning pairs
+    uint8_t first;                      ///< First character
+    uint8_t last;                       ///< Last character
+    uint8_t height;                     ///< Glyph height in pixels, ascent plus descent
+    uint8_t baseline;                   ///< Rows above the baseline
+    uint8_t yAdvance;                   ///< Line spacing
+} ssd1306_font_t;
+
+#endif // _Adafruit_SSD1306_Font_H_
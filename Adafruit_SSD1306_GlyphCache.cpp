@@ -0,0 +1,277 @@
+#include "Adafruit_SSD1306_GlyphCache.h"
+
+/*!
+ * @file Adafruit_SSD1306_GlyphCache.cpp
+ *
+ * Cache of text glyphs pre-rendered in the SSD1306 page format.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+
+// CONSTRUCTOR, DESTRUCTOR -------------------------------------------------
+
+/*!
+    @brief  Constructor for a glyph cache.
+    @param  slots
+            Number of glyphs kept.
+    @param  slotBytes
+            Bytes per glyph: a glyph of w x h pixels needs w * ((h + 7) / 8).
+            6 x 8 text needs 6 bytes at size 1 and 24 at size 2; larger
+            glyphs are drawn by Adafruit_GFX as usual.
+    @return Adafruit_SSD1306_GlyphCache object.
+    @note   RAM use is slots * (slotBytes + sizeof(ssd1306_glyph_t)). If
+            allocation fails the cache stays empty and all text goes
+            through Adafruit_GFX.
+*/
+Adafruit_SSD1306_GlyphCache::Adafruit_SSD1306_GlyphCache(uint8_t slots, uint16_t slotBytes)
+    : slots(slots), slotBytes(slotBytes), clock(0), hits(0), misses(0),
+      lock(xSemaphoreCreateRecursiveMutex())
+{
+    glyphs = (ssd1306_glyph_t *)calloc(slots, sizeof(ssd1306_glyph_t));
+    bitmaps = (uint8_t *)malloc(slots * slotBytes);
+    if (!glyphs || !bitmaps || !lock) {
+        free(glyphs);
+        free(bitmaps);
+        glyphs = NULL;
+        bitmaps = NULL;
+        this->slots = 0;
+    }
+}
+
+/*!
+    @brief  Destructor for Adafruit_SSD1306_GlyphCache object.
+*/
+Adafruit_SSD1306_GlyphCache::~Adafruit_SSD1306_GlyphCache(void)
+{
+    free(glyphs);
+    free(bitmaps);
+    if (lock) {
+        vSemaphoreDelete(lock);
+    }
+}
+
+
+// LOOKUP ------------------------------------------------------------------
+
+/*!
+    @brief  Find a glyph, rendering it into the least recently used slot if
+            it is not cached.
+    @param  font
+            Font as passed to setFont(), NULL for the built-in font.
+    @param  c
+            Character. For the built-in font the caller applies the cp437()
+            adjustment; the glyph is rendered with cp437(true).
+    @param  sizeX
+            Horizontal text size.
+    @param  sizeY
+            Vertical text size.
+    @return The glyph, or NULL if it does not fit in a slot, is missing
+            from the font or could not be rendered.
+    @note   Another task's get() may replace the glyph; tasks sharing the
+            cache hold getLock() until they are done with the result.
+*/
+const ssd1306_glyph_t *Adafruit_SSD1306_GlyphCache::get(const GFXfont *font, uint8_t c,
+                                                        uint8_t sizeX, uint8_t sizeY)
+{
+    ssd1306_glyph_t *victim = NULL;
+    ssd1306_glyph_t probe;
+
+    ssd1306_lock();
+    if (!++clock) {
+        // Timestamps wrapped, start over rather than mis-order the slots
+        clear();
+        clock = 1;
+    }
+    for (uint8_t i = 0; i < slots; i++) {
+        ssd1306_glyph_t *glyph = &glyphs[i];
+        if (glyph->used && (glyph->font == font) && (glyph->c == c) &&
+            (glyph->sizeX == sizeX) && (glyph->sizeY == sizeY)) {
+            glyph->used = clock;
+            hits++;
+            ssd1306_unlock();
+            return glyph;
+        }
+        if (!victim || (glyph->used < victim->used)) {
+            victim = glyph;
+        }
+    }
+
+    // Reject glyphs that cannot be cached before evicting anything
+    misses++;
+    probe.font = font;
+    probe.c = c;
+    probe.sizeX = sizeX;
+    probe.sizeY = sizeY;
+    if (!victim || !measure(&probe)) {
+        ssd1306_unlock();
+        return NULL;
+    }
+    *victim = probe;
+    victim->used = 0;
+    if (render(victim, bitmaps + (victim - glyphs) * slotBytes)) {
+        victim->used = clock;
+    }
+    ssd1306_unlock();
+    return victim->used ? victim : NULL;
+}
+
+/*!
+    @brief  Get the page format bitmap of a cached glyph.
+    @param  glyph
+            Glyph returned by get(), valid until the next get().
+    @return width * ((height + 7) / 8) bytes, see drawPageBitmap().
+*/
+const uint8_t *Adafruit_SSD1306_GlyphCache::getBitmap(const ssd1306_glyph_t *glyph)
+{
+    return bitmaps + (glyph - glyphs) * slotBytes;
+}
+
+/*!
+    @brief  Drop all cached glyphs, e.g. after changing a font in RAM.
+    @return None (void).
+*/
+void Adafruit_SSD1306_GlyphCache::clear(void)
+{
+    ssd1306_lock();
+    for (uint8_t i = 0; i < slots; i++) {
+        glyphs[i].used = 0;
+    }
+    ssd1306_unlock();
+}
+
+/*!
+    @brief  Get the number of lookups served from the cache.
+    @return Hit count.
+*/
+uint32_t Adafruit_SSD1306_GlyphCache::getHits(void)
+{
+    return hits;
+}
+
+/*!
+    @brief  Get the number of lookups that had to render the glyph.
+    @return Miss count.
+*/
+uint32_t Adafruit_SSD1306_GlyphCache::getMisses(void)
+{
+    return misses;
+}
+
+/*!
+    @brief  Get the lock of the cache. Displays take it while they look up
+            and draw a glyph, so another task cannot replace the glyph in
+            between.
+    @return Recursive mutex, or NULL if the cache could not be allocated.
+*/
+SemaphoreHandle_t Adafruit_SSD1306_GlyphCache::getLock(void)
+{
+    return lock;
+}
+
+
+// LOCKING -----------------------------------------------------------------
+
+/*!
+    @brief  Take the cache lock. This is a protected function, not exposed.
+    @return None (void).
+*/
+void Adafruit_SSD1306_GlyphCache::ssd1306_lock(void)
+{
+    if (lock) {
+        xSemaphoreTakeRecursive(lock, portMAX_DELAY);
+    }
+}
+
+/*!
+    @brief  Release the cache lock taken by ssd1306_lock(). This is a
+            protected function, not exposed.
+    @return None (void).
+*/
+void Adafruit_SSD1306_GlyphCache::ssd1306_unlock(void)
+{
+    if (lock) {
+        xSemaphoreGiveRecursive(lock);
+    }
+}
+
+
+// RENDERING ---------------------------------------------------------------
+
+/*!
+    @brief  Fill in the size and offsets of a glyph and check that it fits
+            in a slot. This is a protected function, not exposed.
+    @param  glyph
+            Descriptor with font, c, sizeX and sizeY set.
+    @return true if the glyph can be cached, false if it is missing from
+            the font or too large for a slot.
+*/
+bool Adafruit_SSD1306_GlyphCache::measure(ssd1306_glyph_t *glyph)
+{
+    int16_t w, h;
+
+    if (!glyph->font) {
+        // Built-in font: 5x8 cell plus the spacing column
+        w = 6 * glyph->sizeX;
+        h = 8 * glyph->sizeY;
+        glyph->xOffset = 0;
+        glyph->yOffset = 0;
+    }
+    else {
+        uint16_t first = pgm_read_word(&glyph->font->first);
+        if ((glyph->c < first) || (glyph->c > pgm_read_word(&glyph->font->last))) {
+            return false;
+        }
+        const GFXglyph *g = glyph->font->glyph + (glyph->c - first);
+        w = pgm_read_byte(&g->width) * glyph->sizeX;
+        h = pgm_read_byte(&g->height) * glyph->sizeY;
+        glyph->xOffset = (int8_t)pgm_read_byte(&g->xOffset) * glyph->sizeX;
+        glyph->yOffset = (int8_t)pgm_read_byte(&g->yOffset) * glyph->sizeY;
+    }
+    if ((w > 255) || (h > 255) || (w * ((h + 7) / 8) > slotBytes)) {
+        return false;
+    }
+    glyph->width = (w && h) ? w : 0;
+    glyph->height = h;
+    return true;
+}
+
+/*!
+    @brief  Render a glyph into a slot. This is a protected function, not
+            exposed.
+    @param  glyph
+            Slot descriptor filled in by measure().
+    @param  bitmap
+            Slot bitmap.
+    @return true on success, false if the glyph could not be rendered.
+    @note   Adafruit_GFX draws the glyph into a temporary GFXcanvas1, so the
+            result is exactly what drawChar() would draw.
+*/
+bool Adafruit_SSD1306_GlyphCache::render(ssd1306_glyph_t *glyph, uint8_t *bitmap)
+{
+    int16_t w = glyph->width, h = glyph->height;
+
+    if (!w) {
+        return true;
+    }
+
+    GFXcanvas1 canvas(w, h);
+    if (!canvas.getBuffer()) {
+        return false;
+    }
+    canvas.cp437(true);
+    canvas.setFont(glyph->font);
+    canvas.drawChar(-glyph->xOffset, -glyph->yOffset, glyph->c, 1, 0,
+                    glyph->sizeX, glyph->sizeY);
+
+    memset(bitmap, 0, w * ((h + 7) / 8));
+    for (int16_t y = 0; y < h; y++) {
+        for (int16_t x = 0; x < w; x++) {
+            if (canvas.getPixel(x, y)) {
+                bitmap[(y / 8) * w + x] |= 1 << (y & 7);
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,77 @@
+/*!
+ * @file Adafruit_SSD1306_GlyphCache.h
+ *
+ * Cache of text glyphs pre-rendered in the SSD1306 page format.
+ *
+ * Adafruit_GFX draws text a font pixel at a time, and with setTextSize()
+ * each pixel becomes a filled rectangle. With a cache attached through
+ * Adafruit_SSD1306::setGlyphCache(), each glyph is rendered once per font
+ * and text size and then drawn with drawPageBitmap(), a byte per column
+ * and page. The cache has a fixed number of equally sized slots; when it
+ * is full the least recently used glyph is replaced.
+ *
+ * One cache may serve several displays, also from several tasks: lookups
+ * are guarded by the cache's own lock.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+#ifndef _Adafruit_SSD1306_GlyphCache_H_
+#define _Adafruit_SSD1306_GlyphCache_H_
+
+#include <Adafruit_GFX.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#define SSD1306_GLYPH_SLOTS 16      ///< Default number of cached glyphs
+#define SSD1306_GLYPH_SLOT_BYTES 64 ///< Default bytes per cached glyph
+
+/// A cached glyph, its page format bitmap is in the matching slot
+typedef struct {
+    const GFXfont *font; ///< Font, NULL for the built-in 6x8 font
+    uint8_t c;           ///< Character, after the cp437 adjustment
+    uint8_t sizeX;       ///< Horizontal text size
+    uint8_t sizeY;       ///< Vertical text size
+    uint8_t width;       ///< Bitmap width in pixels, 0 for blank glyphs
+    uint8_t height;      ///< Bitmap height in pixels
+    int16_t xOffset;     ///< Bitmap position relative to the cursor
+    int16_t yOffset;     ///< Bitmap position relative to the cursor
+    uint32_t used;       ///< Time of last use, 0 if the slot is free
+} ssd1306_glyph_t;
+
+/*!
+    @brief  LRU cache of glyphs rendered in the SSD1306 page format.
+*/
+class Adafruit_SSD1306_GlyphCache {
+
+public:
+    Adafruit_SSD1306_GlyphCache(uint8_t slots = SSD1306_GLYPH_SLOTS,
+                                uint16_t slotBytes = SSD1306_GLYPH_SLOT_BYTES);
+    ~Adafruit_SSD1306_GlyphCache(void);
+
+    const ssd1306_glyph_t *get(const GFXfont *font, uint8_t c,
+                               uint8_t sizeX, uint8_t sizeY);
+    const uint8_t *getBitmap(const ssd1306_glyph_t *glyph);
+    void clear(void);
+    uint32_t getHits(void);
+    uint32_t getMisses(void);
+    SemaphoreHandle_t getLock(void);
+
+protected:
+    uint8_t slots;           ///< Number of slots, 0 if allocation failed
+    uint16_t slotBytes;      ///< Bitmap bytes per slot
+    ssd1306_glyph_t *glyphs; ///< Slot descriptors
+    uint8_t *bitmaps;        ///< Slot bitmaps, slotBytes each
+    uint32_t clock;          ///< Advances on every lookup, for the LRU
+    uint32_t hits;           ///< Lookups served from the cache
+    uint32_t misses;         ///< Lookups that rendered the glyph
+    SemaphoreHandle_t lock;  ///< Recursive mutex guarding all of the above
+
+    void ssd1306_lock(void);
+    void ssd1306_unlock(void);
+    bool measure(ssd1306_glyph_t *glyph);
+    bool render(ssd1306_glyph_t *glyph, uint8_t *bitmap);
+};
+
+#endif // _Adafruit_SSD1306_GlyphCache_H_
@@ -0,0 +1,452 @@
+#include "Adafruit_SSD1306_Manager.h"
+
+/*!
+ * @file Adafruit_SSD1306_Manager.cpp
+ *
+ * Flush scheduler for several SSD1306 displays sharing one I2C bus.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+
+// CONSTRUCTOR, DESTRUCTOR -------------------------------------------------
+
+/*!
+    @brief  Constructor for a display manager.
+    @param  policy
+            SSD1306_SCHEDULE_ROUND_ROBIN or SSD1306_SCHEDULE_PRIORITY.
+    @return Adafruit_SSD1306_Manager object.
+    @note   The displays must each have been started with begin() before
+            they are added.
+*/
+Adafruit_SSD1306_Manager::Adafruit_SSD1306_Manager(ssd1306_schedule_t policy)
+    : count(0), next(0), last(-1), policy(policy), minInterval(0), task(NULL), events(NULL),
+      lock(NULL), requested(0), completed(0), running(false)
+{
+    portMUX_INITIALIZE(&spin);
+}
+
+/*!
+    @brief  Destructor for Adafruit_SSD1306_Manager object. Stops the flush
+            task if it is running.
+*/
+Adafruit_SSD1306_Manager::~Adafruit_SSD1306_Manager(void)
+{
+    stop();
+    if (lock) {
+        vSemaphoreDelete(lock);
+    }
+}
+
+
+// DISPLAY LIST ------------------------------------------------------------
+
+/*!
+    @brief  Register a display with the manager.
+    @param  display
+            Display to be flushed by this manager.
+    @param  priority
+            Only used with SSD1306_SCHEDULE_PRIORITY, higher values are
+            served first.
+    @return true if added, false if the manager is full.
+    @note   Safe to call while the flush task is running, the display list
+            is guarded by the manager lock.
+*/
+bool Adafruit_SSD1306_Manager::add(Adafruit_SSD1306 *display, uint8_t priority)
+{
+    bool added = false;
+
+    ssd1306_lock();
+    if (count < SSD1306_MANAGER_MAX_DISPLAYS) {
+        displays[count] = display;
+        priorities[count] = priority;
+        busy[count] = false;
+        count++;
+        added = true;
+    }
+    ssd1306_unlock();
+    return added;
+}
+
+/*!
+    @brief  Unregister a display.
+    @param  display
+            Display previously passed to add().
+    @return true if removed, false if it was not registered.
+    @note   Once this returns the flush task no longer touches the display,
+            so it may be deleted. If a page of the display is on the bus,
+            this waits for the transfer to end.
+*/
+bool Adafruit_SSD1306_Manager::remove(Adafruit_SSD1306 *display)
+{
+    ssd1306_lock();
+    int8_t i = ssd1306_find(display);
+    while ((i >= 0) && busy[i]) {
+        ssd1306_unlock();
+        vTaskDelay(1);
+        ssd1306_lock();
+        i = ssd1306_find(display);
+    }
+    if (i >= 0) {
+        count--;
+        for (; i < count; i++) {
+            displays[i] = displays[i + 1];
+            priorities[i] = priorities[i + 1];
+            busy[i] = busy[i + 1];
+        }
+        next = 0;
+        last = -1;
+    }
+    ssd1306_unlock();
+    return i >= 0;
+}
+
+/*!
+    @brief  Change the scheduling policy.
+    @param  policy
+            SSD1306_SCHEDULE_ROUND_ROBIN or SSD1306_SCHEDULE_PRIORITY.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Manager::setPolicy(ssd1306_schedule_t policy)
+{
+    ssd1306_lock();
+    this->policy = policy;
+    ssd1306_unlock();
+}
+
+
+/*!
+    @brief  Cap the rate at which the flush task updates the displays.
+    @param  fps
+            Maximum flushes per second, 0 for no limit.
+    @return None (void).
+    @note   A requestFlush() is served at most one frame period after the
+            previous flush; all requests made in between are coalesced into
+            a single flush of the union of the changed areas. The period is
+            rounded up to whole FreeRTOS ticks.
+*/
+void Adafruit_SSD1306_Manager::setMaxFps(uint16_t fps)
+{
+    minInterval = fps ? (configTICK_RATE_HZ + fps - 1) / fps : 0;
+}
+
+
+// FLUSHING ----------------------------------------------------------------
+
+/*!
+    @brief  Push one changed page of the display whose turn it is.
+    @return true if a page was sent, false if all displays are up to date.
+    @note   Displays of equal priority are served round-robin, starting
+            after the one served last, so none of them can be starved by
+            another one's full refresh. A display behind a multiplexer
+            keeps its turn until it is up to date: serving another display
+            in between would reselect the channel for every page.
+            The manager lock is only held to pick the display, not during
+            the transfer; a display already being sent by another task
+            calling flushStep() is skipped.
+*/
+bool Adafruit_SSD1306_Manager::flushStep(void)
+{
+    int8_t pick = -1;
+    uint8_t start;
+
+    ssd1306_lock();
+    start = next;
+    if ((last >= 0) && displays[last]->getMux() && displays[last]->isDirty()) {
+        start = last;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t idx = (start + i) % count;
+        if (busy[idx] || !displays[idx]->isDirty()) {
+            continue;
+        }
+        if (policy == SSD1306_SCHEDULE_ROUND_ROBIN) {
+            pick = idx;
+            break;
+        }
+        if ((pick < 0) || (priorities[idx] > priorities[pick])) {
+            pick = idx;
+        }
+    }
+    if (pick < 0) {
+        ssd1306_unlock();
+        return false;
+    }
+    Adafruit_SSD1306 *display = displays[pick];
+    busy[pick] = true;
+    next = (pick + 1) % count;
+    last = pick;
+    ssd1306_unlock();
+
+    display->displayDirtyPage();
+
+    // remove() waits for busy to clear, so the display is still listed,
+    // though maybe at another index
+    ssd1306_lock();
+    busy[ssd1306_find(display)] = false;
+    ssd1306_unlock();
+    return true;
+}
+
+/*!
+    @brief  Push all pending changes of all displays.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Manager::flush(void)
+{
+    while (flushStep()) {
+    }
+}
+
+
+// FLUSH TASK --------------------------------------------------------------
+
+/*!
+    @brief  Start the task that flushes the displays whenever
+            requestFlush() is called.
+    @param  taskPriority
+            FreeRTOS priority of the flush task.
+    @param  stackSize
+            Stack size of the flush task.
+    @return true if the task is running, false if it could not be created.
+*/
+bool Adafruit_SSD1306_Manager::start(UBaseType_t taskPriority, uint32_t stackSize)
+{
+    if (task) {
+        return true;
+    }
+    if (!lock && !(lock = xSemaphoreCreateMutex())) {
+        return false;
+    }
+    if (!events && !(events = xEventGroupCreate())) {
+        return false;
+    }
+    portENTER_CRITICAL(&spin);
+    completed = requested;
+    portEXIT_CRITICAL(&spin);
+    xEventGroupSetBits(events, SSD1306_MANAGER_IDLE_BIT);
+    running = true;
+    if (xTaskCreate(flushTask, "ssd1306_flush", stackSize, this, taskPriority, &task) != pdPASS) {
+        running = false;
+        task = NULL;
+        return false;
+    }
+    return true;
+}
+
+/*!
+    @brief  Stop the flush task, waiting for the current flush to finish.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Manager::stop(void)
+{
+    if (!task) {
+        return;
+    }
+    running = false;
+    xTaskNotifyGive(task);
+    while (task) {
+        vTaskDelay(1);
+    }
+    vEventGroupDelete(events);
+    events = NULL;
+}
+
+/*!
+    @brief  Wake the flush task. Safe to call from any task, requests made
+            while a flush is in progress are coalesced into the next one.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Manager::requestFlush(void)
+{
+    if (task) {
+        portENTER_CRITICAL(&spin);
+        requested++;
+        portEXIT_CRITICAL(&spin);
+        xEventGroupClearBits(events, SSD1306_MANAGER_IDLE_BIT);
+        xTaskNotifyGive(task);
+    }
+}
+
+/*!
+    @brief  Wait for the flush task to send everything requested so far.
+    @param  timeout
+            Maximum time to wait, in ticks.
+    @return true once idle, false on timeout. Returns true immediately if
+            the flush task is not running.
+*/
+bool Adafruit_SSD1306_Manager::waitIdle(TickType_t timeout)
+{
+    if (!task) {
+        return true;
+    }
+    portENTER_CRITICAL(&spin);
+    uint32_t target = requested;
+    portEXIT_CRITICAL(&spin);
+
+    TickType_t begun = xTaskGetTickCount();
+    while (!ssd1306_done(target)) {
+        TickType_t waited = xTaskGetTickCount() - begun;
+        if ((timeout != portMAX_DELAY) && (waited >= timeout)) {
+            return false;
+        }
+        EventBits_t bits = xEventGroupWaitBits(events, SSD1306_MANAGER_IDLE_BIT, pdFALSE, pdTRUE,
+                                               (timeout == portMAX_DELAY) ? portMAX_DELAY
+                                                                          : timeout - waited);
+        if ((bits & SSD1306_MANAGER_IDLE_BIT) && !ssd1306_done(target)) {
+            // Set by a flush that ended as a new request came in, the
+            // flush task clears it again right away
+            vTaskDelay(1);
+        }
+    }
+    return true;
+}
+
+/*!
+    @brief  Flush the displays of several managers at the same time and
+            wait for all of them, e.g. one manager per ESP32 I2C port.
+    @param  managers
+            Array of managers, each on its own I2C port.
+    @param  n
+            Number of managers in the array.
+    @param  timeout
+            Maximum time to wait for each manager, in ticks.
+    @return true if every manager finished in time.
+    @note   Managers whose flush task is not started are flushed from the
+            calling task while the others run, so a single-port setup
+            needs no extra task.
+*/
+bool Adafruit_SSD1306_Manager::flushParallel(Adafruit_SSD1306_Manager *const *managers,
+                                             uint8_t n, TickType_t timeout)
+{
+    bool done = true;
+
+    for (uint8_t i = 0; i < n; i++) {
+        managers[i]->requestFlush();
+    }
+    for (uint8_t i = 0; i < n; i++) {
+        if (!managers[i]->task) {
+            managers[i]->flush();
+        }
+    }
+    for (uint8_t i = 0; i < n; i++) {
+        if (!managers[i]->waitIdle(timeout)) {
+            done = false;
+        }
+    }
+    return done;
+}
+
+/*!
+    @brief  Body of the flush task.
+    @param  arg
+            The Adafruit_SSD1306_Manager that started the task.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Manager::flushTask(void *arg)
+{
+    Adafruit_SSD1306_Manager *self = (Adafruit_SSD1306_Manager *)arg;
+    TickType_t lastFlush = xTaskGetTickCount() - self->minInterval;
+
+    while (self->running) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        TickType_t elapsed = xTaskGetTickCount() - lastFlush;
+        if (self->running && (elapsed < self->minInterval)) {
+            vTaskDelay(self->minInterval - elapsed);
+            // Requests made while waiting are served by this flush, they
+            // are counted in requested so none of them is lost
+            ulTaskNotifyTake(pdTRUE, 0);
+        }
+        lastFlush = xTaskGetTickCount();
+
+        // Anything drawn before a request counted here is picked up by
+        // this flush; later requests keep the task busy
+        portENTER_CRITICAL(&self->spin);
+        uint32_t seen = self->requested;
+        portEXIT_CRITICAL(&self->spin);
+        self->flush();
+
+        // Only report idle if no request arrived during the flush, whose
+        // changes may have missed a display that was already checked.
+        // Such a request has also notified the task, so it loops at once.
+        portENTER_CRITICAL(&self->spin);
+        self->completed = seen;
+        bool idle = (self->requested == seen);
+        portEXIT_CRITICAL(&self->spin);
+        if (idle) {
+            xEventGroupSetBits(self->events, SSD1306_MANAGER_IDLE_BIT);
+            // A request between the check and the set has cleared the bit
+            // before it was set, clear it again
+            portENTER_CRITICAL(&self->spin);
+            idle = (self->requested == seen);
+            portEXIT_CRITICAL(&self->spin);
+            if (!idle) {
+                xEventGroupClearBits(self->events, SSD1306_MANAGER_IDLE_BIT);
+            }
+        }
+    }
+    self->task = NULL;
+    vTaskDelete(NULL);
+}
+
+
+// LOCKING -----------------------------------------------------------------
+
+/*!
+    @brief  Take the manager lock, if start() has created it.
+    @return None (void).
+    @note   This is a protected function, not exposed.
+*/
+void Adafruit_SSD1306_Manager::ssd1306_lock(void)
+{
+    if (lock) {
+        xSemaphoreTake(lock, portMAX_DELAY);
+    }
+}
+
+/*!
+    @brief  Release the manager lock taken by ssd1306_lock().
+    @return None (void).
+    @note   This is a protected function, not exposed.
+*/
+void Adafruit_SSD1306_Manager::ssd1306_unlock(void)
+{
+    if (lock) {
+        xSemaphoreGive(lock);
+    }
+}
+
+/*!
+    @brief  Find a display in the display list. Call with the manager lock
+            held.
+    @param  display
+            Display to look for.
+    @return Index of the display, or -1 if it is not registered.
+    @note   This is a protected function, not exposed.
+*/
+int8_t Adafruit_SSD1306_Manager::ssd1306_find(Adafruit_SSD1306 *display)
+{
+    for (uint8_t i = 0; i < count; i++) {
+        if (displays[i] == display) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*!
+    @brief  Check whether a flush has started from a given request count.
+    @param  target
+            Value of requested to compare against.
+    @return true if the last finished flush covered every request up to
+            target.
+    @note   This is a protected function, not exposed.
+*/
+bool Adafruit_SSD1306_Manager::ssd1306_done(uint32_t target)
+{
+    portENTER_CRITICAL(&spin);
+    bool done = (int32_t)(completed - target) >= 0;
+    portEXIT_CRITICAL(&spin);
+    return done;
+}
@@ -0,0 +1,91 @@
+/*!
+ * @file Adafruit_SSD1306_Manager.h
+ *
+ * Flush scheduler for several SSD1306 displays sharing one I2C bus.
+ *
+ * Each display keeps its own buffer and drawing API; the manager owns the
+ * bus side and pushes the changed pages of all registered displays from a
+ * single task, one page at a time, so a full refresh of one panel cannot
+ * hold the bus away from the others. Displays behind a multiplexer are the
+ * exception: each of them is drained before the next one is served, since
+ * switching displays there costs a channel select.
+ *
+ * Requests coming faster than the rate set with setMaxFps() are coalesced
+ * into one transfer of everything changed meanwhile.
+ *
+ * Use one manager per I2C port; flushParallel() updates the displays of
+ * several managers concurrently, one task per port.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+#ifndef _Adafruit_SSD1306_Manager_H_
+#define _Adafruit_SSD1306_Manager_H_
+
+#include "Adafruit_SSD1306.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
+
+#define SSD1306_MANAGER_MAX_DISPLAYS 8 ///< Displays per manager
+#define SSD1306_MANAGER_IDLE_BIT 0x01  ///< Event bit set while nothing is pending
+
+/// Order in which the manager serves displays with pending changes
+typedef enum {
+    SSD1306_SCHEDULE_ROUND_ROBIN, ///< One page from each display in turn,
+                                  ///< all pages of a display behind a mux
+    SSD1306_SCHEDULE_PRIORITY     ///< Highest priority display first
+} ssd1306_schedule_t;
+
+/*!
+    @brief  Schedules the updates of several Adafruit_SSD1306 displays on a
+            shared bus.
+*/
+class Adafruit_SSD1306_Manager {
+
+public:
+    Adafruit_SSD1306_Manager(ssd1306_schedule_t policy = SSD1306_SCHEDULE_ROUND_ROBIN);
+    ~Adafruit_SSD1306_Manager(void);
+
+    bool add(Adafruit_SSD1306 *display, uint8_t priority = 0);
+    bool remove(Adafruit_SSD1306 *display);
+    void setPolicy(ssd1306_schedule_t policy);
+    void setMaxFps(uint16_t fps);
+    bool flushStep(void);
+    void flush(void);
+    bool start(UBaseType_t taskPriority = 5, uint32_t stackSize = 2048);
+    void stop(void);
+    void requestFlush(void);
+    bool waitIdle(TickType_t timeout = portMAX_DELAY);
+
+    static bool flushParallel(Adafruit_SSD1306_Manager *const *managers, uint8_t n,
+                              TickType_t timeout = portMAX_DELAY);
+
+protected:
+    Adafruit_SSD1306 *displays[SSD1306_MANAGER_MAX_DISPLAYS]; ///< Registered displays
+    uint8_t priorities[SSD1306_MANAGER_MAX_DISPLAYS];         ///< Priority of each display
+    bool busy[SSD1306_MANAGER_MAX_DISPLAYS];                  ///< A page of it is being sent
+    uint8_t count;                 ///< Number of registered displays
+    uint8_t next;                  ///< Display to serve first on the next step
+    int8_t last;                   ///< Display served last, -1 for none
+    ssd1306_schedule_t policy;     ///< Current scheduling policy
+    TickType_t minInterval;        ///< Minimum ticks between flushes, 0 for none
+    TaskHandle_t task;             ///< Flush task, NULL when not started
+    EventGroupHandle_t events;     ///< Holds SSD1306_MANAGER_IDLE_BIT
+    SemaphoreHandle_t lock;        ///< Guards the display list and busy[]
+    portMUX_TYPE spin;             ///< Guards requested and completed
+    uint32_t requested;            ///< Count of requestFlush() calls
+    uint32_t completed;            ///< Value of requested the last flush started from
+    volatile bool running;         ///< Cleared to ask the flush task to exit
+
+    void ssd1306_lock(void);
+    void ssd1306_unlock(void);
+    int8_t ssd1306_find(Adafruit_SSD1306 *display);
+    bool ssd1306_done(uint32_t target);
+
+    static void flushTask(void *arg);
+};
+
+#endif // _Adafruit_SSD1306_Manager_H_
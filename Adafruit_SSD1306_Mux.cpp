@@ -0,0 +1,115 @@
+#include "Adafruit_SSD1306_Mux.h"
+
+/*!
+ * @file Adafruit_SSD1306_Mux.cpp
+ *
+ * TCA9548A I2C multiplexer support, for driving several SSD1306 displays
+ * that share the same I2C address.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+/*!
+    @brief  Constructor for a TCA9548A multiplexer.
+    @param  port
+            I2C port the multiplexer is connected to.
+    @param  addr
+            I2C address of the multiplexer, 0x70 to 0x77.
+    @param  busMutex
+            Recursive mutex (xSemaphoreCreateRecursiveMutex()) shared with
+            other devices on the same port, or NULL to create one for the
+            multiplexer and the displays behind it.
+    @return Adafruit_SSD1306_Mux object.
+*/
+Adafruit_SSD1306_Mux::Adafruit_SSD1306_Mux(i2c_port_t port, uint8_t addr,
+                                           SemaphoreHandle_t busMutex)
+    : i2c(port), i2caddr(addr), channel(TCA9548A_NO_CHANNEL),
+      lock(busMutex ? busMutex : xSemaphoreCreateRecursiveMutex()), ownLock(busMutex == NULL)
+{
+}
+
+/*!
+    @brief  Destructor for Adafruit_SSD1306_Mux object. The displays behind
+            it must not be used any more.
+*/
+Adafruit_SSD1306_Mux::~Adafruit_SSD1306_Mux(void)
+{
+    if (lock && ownLock) {
+        vSemaphoreDelete(lock);
+    }
+}
+
+/*!
+    @brief  Route the bus to one downstream channel.
+    @param  channel
+            Channel 0 to 7.
+    @param  sent
+            Set to true if a select transaction was issued, failed or
+            not, false if nothing went on the bus. May be NULL.
+    @return ESP_OK if the channel is selected, otherwise the I2C error.
+    @note   Nothing is sent if the channel is already selected. Callers
+            other than the displays must hold getLock() across the select
+            and the transfer that follows it.
+*/
+esp_err_t Adafruit_SSD1306_Mux::select(uint8_t channel, bool *sent)
+{
+    if (sent) {
+        *sent = false;
+    }
+    if (channel == this->channel) {
+        return ESP_OK;
+    }
+    if (channel >= TCA9548A_CHANNELS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    if (cmd == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    i2c_master_start(cmd);
+    i2c_master_write_byte(cmd, (i2caddr << 1) | I2C_MASTER_WRITE, true);
+    i2c_master_write_byte(cmd, 1 << channel, true);
+    i2c_master_stop(cmd);
+    esp_err_t err = ESP_ERROR_CHECK_WITHOUT_ABORT(i2c_master_cmd_begin(i2c, cmd, 10/portTICK_PERIOD_MS));
+    i2c_cmd_link_delete(cmd);
+    if (sent) {
+        *sent = true;
+    }
+
+    // On failure the multiplexer state is unknown, force a select next time
+    this->channel = (err == ESP_OK) ? channel : TCA9548A_NO_CHANNEL;
+    return err;
+}
+
+/*!
+    @brief  Forget the cached channel, for when other code wrote to the
+            multiplexer directly.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Mux::invalidate(void)
+{
+    channel = TCA9548A_NO_CHANNEL;
+}
+
+/*!
+    @brief  Get the channel selected last.
+    @return Channel 0 to 7, or TCA9548A_NO_CHANNEL.
+*/
+uint8_t Adafruit_SSD1306_Mux::getChannel(void)
+{
+    return channel;
+}
+
+/*!
+    @brief  Get the bus lock of the multiplexer. Displays set up with
+            setMux() use it as their bus lock when enableLocking() is
+            called, so one display's select and transfer are never split
+            by another's.
+    @return Recursive mutex, or NULL if it could not be created.
+*/
+SemaphoreHandle_t Adafruit_SSD1306_Mux::getLock(void)
+{
+    return lock;
+}
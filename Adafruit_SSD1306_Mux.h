@@ -0,0 +1,48 @@
+/*!
+ * @file Adafruit_SSD1306_Mux.h
+ *
+ * TCA9548A I2C multiplexer support, for driving several SSD1306 displays
+ * that share the same I2C address.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+#ifndef _Adafruit_SSD1306_Mux_H_
+#define _Adafruit_SSD1306_Mux_H_
+
+#include "driver/i2c.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#define TCA9548A_DEFAULT_ADDR 0x70 ///< Address with A0..A2 tied low
+#define TCA9548A_CHANNELS 8        ///< Downstream channels
+#define TCA9548A_NO_CHANNEL 0xFF   ///< Selected channel is unknown
+
+/*!
+    @brief  Selects TCA9548A channels, remembering the current one so that
+            consecutive transfers to the same display skip the select.
+            The cached channel is guarded by the multiplexer's bus lock,
+            which every display behind it uses once locking is enabled.
+*/
+class Adafruit_SSD1306_Mux {
+
+public:
+    Adafruit_SSD1306_Mux(i2c_port_t port, uint8_t addr = TCA9548A_DEFAULT_ADDR,
+                         SemaphoreHandle_t busMutex = NULL);
+    ~Adafruit_SSD1306_Mux(void);
+
+    esp_err_t select(uint8_t channel, bool *sent = NULL);
+    void invalidate(void);
+    uint8_t getChannel(void);
+    SemaphoreHandle_t getLock(void);
+
+protected:
+    i2c_port_t i2c;     ///< Port the multiplexer is connected to
+    uint8_t i2caddr;    ///< I2C address of the multiplexer
+    uint8_t channel;    ///< Channel selected last, or TCA9548A_NO_CHANNEL
+    SemaphoreHandle_t lock; ///< Bus lock shared by the displays behind it
+    bool ownLock;       ///< lock was created by the constructor
+};
+
+#endif // _Adafruit_SSD1306_Mux_H_
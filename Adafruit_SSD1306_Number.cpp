@@ -0,0 +1,222 @@
+#include "Adafruit_SSD1306_Number.h"
+
+/*!
+ * @file Adafruit_SSD1306_Number.cpp
+ *
+ * Numeric display widget with incremental updates for SSD1306 displays.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+
+// CONSTRUCTOR -------------------------------------------------------------
+
+/*!
+    @brief  Constructor for a number widget. Nothing is drawn until the
+            first update().
+    @param  display
+            Display to draw into, started with begin().
+    @param  font
+            Page format font with at least '0' to '9'; '-' and '.' are
+            used if present.
+    @param  x
+            Left column.
+    @param  y
+            Top row, preferably a multiple of 8.
+    @param  digits
+            Number of digit cells, including one for a minus sign if
+            negative values are shown; at most SSD1306_NUMBER_MAX_DIGITS.
+    @param  decimals
+            Digits after the decimal point, 0 for integers.
+    @return Adafruit_SSD1306_Number object.
+    @note   Digit cells are as wide as the widest of '0' to '9' and '-',
+            ink included, so proportional fonts keep their digits in place.
+*/
+Adafruit_SSD1306_Number::Adafruit_SSD1306_Number(Adafruit_SSD1306 *display,
+                                                 const ssd1306_font_t *font,
+                                                 int16_t x, int16_t y,
+                                                 uint8_t digits, uint8_t decimals)
+    : display(display), font(font), x(x), y(y), color(SSD1306_WHITE), bg(SSD1306_BLACK)
+{
+    if (digits > SSD1306_NUMBER_MAX_DIGITS) {
+        digits = SSD1306_NUMBER_MAX_DIGITS;
+    }
+    if (decimals >= digits) {
+        decimals = digits ? digits - 1 : 0;
+    }
+    this->digits = digits;
+    this->decimals = decimals;
+    cells = digits + (decimals ? 1 : 0);
+
+    digitWidth = extent('-');
+    for (char c = '0'; c <= '9'; c++) {
+        if (extent(c) > digitWidth) {
+            digitWidth = extent(c);
+        }
+    }
+    pointWidth = decimals ? extent('.') : 0;
+
+    memset(wanted, ' ', cells);
+    invalidate();
+}
+
+
+// VALUE -------------------------------------------------------------------
+
+/*!
+    @brief  Set the colors. Takes effect at the next update(), which
+            redraws all cells.
+    @param  color
+            Digit color.
+    @param  bg
+            Background color.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Number::setColor(uint16_t color, uint16_t bg)
+{
+    this->color = color;
+    this->bg = bg;
+    invalidate();
+}
+
+/*!
+    @brief  Set the value shown at the next update().
+    @param  value
+            Fixed-point value: with 2 decimals, 1234 shows as 12.34. Values
+            that do not fit show as dashes.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Number::setValue(int32_t value)
+{
+    bool negative = value < 0;
+    uint32_t v = negative ? -(uint32_t)value : value;
+    char *cell = wanted + cells;
+
+    // Fill from the right: fraction, at least one integer digit, then
+    // further digits, the sign and blanks
+    for (uint8_t k = 0; k < digits; k++) {
+        if (decimals && (k == decimals)) {
+            *--cell = '.';
+        }
+        if (v || (k <= decimals)) {
+            *--cell = '0' + v % 10;
+            v /= 10;
+        }
+        else if (negative) {
+            *--cell = '-';
+            negative = false;
+        }
+        else {
+            *--cell = ' ';
+        }
+    }
+    if (v || negative) {
+        for (uint8_t i = 0; i < cells; i++) {
+            wanted[i] = (wanted[i] == '.') ? '.' : '-';
+        }
+    }
+}
+
+/*!
+    @brief  Redraw the cells that changed since the last update().
+    @param  flush
+            true (default) to send them with displayDirty(), false to leave
+            that to the caller, e.g. an Adafruit_SSD1306_Manager.
+    @return true if any cell was redrawn.
+*/
+bool Adafruit_SSD1306_Number::update(bool flush)
+{
+    bool changed = false;
+    int16_t cx = x;
+
+    display->startWrite();
+    for (uint8_t i = 0; i < cells; i++) {
+        uint8_t w = (wanted[i] == '.') ? pointWidth : digitWidth;
+        if (shown[i] != wanted[i]) {
+            drawCell(cx, w, wanted[i]);
+            shown[i] = wanted[i];
+            changed = true;
+        }
+        cx += w;
+    }
+    display->endWrite();
+
+    if (changed && flush) {
+        display->displayDirty();
+    }
+    return changed;
+}
+
+/*!
+    @brief  Forget what is in the buffer, so the next update() redraws all
+            cells, e.g. after clearDisplay().
+    @return None (void).
+*/
+void Adafruit_SSD1306_Number::invalidate(void)
+{
+    memset(shown, 0, sizeof(shown));
+}
+
+/*!
+    @brief  Get the width of the widget.
+    @return Width in pixels.
+*/
+int16_t Adafruit_SSD1306_Number::width(void)
+{
+    return digits * digitWidth + pointWidth;
+}
+
+
+// DRAWING -----------------------------------------------------------------
+
+/*!
+    @brief  Get the width a character needs. This is a protected function,
+            not exposed.
+    @param  c
+            Character.
+    @return Advance or right edge of the ink, whichever is larger; 0 if
+            the font does not have the character.
+*/
+uint8_t Adafruit_SSD1306_Number::extent(char c)
+{
+    uint8_t first = pgm_read_byte(&font->first);
+    if (((uint8_t)c < first) || ((uint8_t)c > pgm_read_byte(&font->last))) {
+        return 0;
+    }
+    const ssd1306_font_glyph_t *glyph =
+        (const ssd1306_font_glyph_t *)pgm_read_pointer(&font->glyphs) + ((uint8_t)c - first);
+    int16_t ink = (int8_t)pgm_read_byte(&glyph->xOffset) + pgm_read_byte(&glyph->width);
+    uint8_t advance = pgm_read_byte(&glyph->advance);
+    return (ink > advance) ? ink : advance;
+}
+
+/*!
+    @brief  Draw one cell, the character centered on the background. This
+            is a protected function, not exposed.
+    @param  cx
+            Left column of the cell.
+    @param  w
+            Cell width.
+    @param  c
+            Character, ' ' for a blank cell.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Number::drawCell(int16_t cx, uint8_t w, char c)
+{
+    uint8_t h = pgm_read_byte(&font->height);
+    uint8_t e = (c == ' ') ? 0 : extent(c);
+    uint8_t pad = (w - e) / 2;
+    char text[2] = { c, 0 };
+
+    // drawPageText() fills the character's own extent
+    if (pad) {
+        display->fillRect(cx, y, pad, h, bg);
+    }
+    if (e) {
+        display->drawPageText(cx + pad, y, font, text, color, bg);
+    }
+    if (w > pad + e) {
+        display->fillRect(cx + pad + e, y, w - pad - e, h, bg);
+    }
+}
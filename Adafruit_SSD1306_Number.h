@@ -0,0 +1,57 @@
+/*!
+ * @file Adafruit_SSD1306_Number.h
+ *
+ * Numeric display widget for large digits in a page format font, e.g. a
+ * 16, 24 or 32 pixel tall digit set converted with scripts/make_font.py.
+ *
+ * The number occupies fixed cells, one per digit plus the sign and the
+ * decimal point. When the value changes only the cells whose character
+ * changed are redrawn, and displayDirty() sends only those columns; at a
+ * row that is a multiple of 8 a cell is whole buffer bytes.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+#ifndef _Adafruit_SSD1306_Number_H_
+#define _Adafruit_SSD1306_Number_H_
+
+#include "Adafruit_SSD1306.h"
+
+#define SSD1306_NUMBER_MAX_DIGITS 10 ///< Digits of an int32_t
+
+/*!
+    @brief  Fixed-point number drawn into an Adafruit_SSD1306 buffer.
+*/
+class Adafruit_SSD1306_Number {
+
+public:
+    Adafruit_SSD1306_Number(Adafruit_SSD1306 *display, const ssd1306_font_t *font,
+                            int16_t x, int16_t y, uint8_t digits, uint8_t decimals = 0);
+
+    void setColor(uint16_t color, uint16_t bg);
+    void setValue(int32_t value);
+    bool update(bool flush = true);
+    void invalidate(void);
+    int16_t width(void);
+
+protected:
+    Adafruit_SSD1306 *display;  ///< Display drawn into
+    const ssd1306_font_t *font; ///< Digit font
+    int16_t x;                  ///< Left column
+    int16_t y;                  ///< Top row
+    uint8_t digits;             ///< Digit cells, sign included
+    uint8_t decimals;           ///< Digits after the decimal point
+    uint8_t cells;              ///< Cells, decimal point included
+    uint8_t digitWidth;         ///< Width of a digit or sign cell
+    uint8_t pointWidth;         ///< Width of the decimal point cell
+    uint16_t color;             ///< Digit color
+    uint16_t bg;                ///< Background color
+    char shown[SSD1306_NUMBER_MAX_DIGITS + 2]; ///< Cells in the buffer, 0 if unknown
+    char wanted[SSD1306_NUMBER_MAX_DIGITS + 2]; ///< Cells for the current value
+
+    uint8_t extent(char c);
+    void drawCell(int16_t cx, uint8_t w, char c);
+};
+
+#endif // _Adafruit_SSD1306_Number_H_
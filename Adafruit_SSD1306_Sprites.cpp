@@ -0,0 +1,423 @@
+#include "Adafruit_SSD1306_Sprites.h"
+
+/*!
+ * @file Adafruit_SSD1306_Sprites.cpp
+ *
+ * Sprite layer with background save/restore for SSD1306 displays.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+
+// CONSTRUCTOR, DESTRUCTOR -------------------------------------------------
+
+/*!
+    @brief  Constructor for a sprite layer.
+    @param  display
+            Display to draw into, started with begin().
+    @return Adafruit_SSD1306_Sprites object.
+    @note   Sprite coordinates are buffer coordinates, i.e. rotation 0.
+*/
+Adafruit_SSD1306_Sprites::Adafruit_SSD1306_Sprites(Adafruit_SSD1306 *display)
+    : display(display)
+{
+    memset(sprites, 0, sizeof(sprites));
+}
+
+/*!
+    @brief  Destructor for Adafruit_SSD1306_Sprites object. Sprites are left
+            in the buffer as they are.
+*/
+Adafruit_SSD1306_Sprites::~Adafruit_SSD1306_Sprites(void)
+{
+    for (uint8_t i = 0; i < SSD1306_SPRITES_MAX; i++) {
+        free(sprites[i].saved);
+    }
+}
+
+
+// SPRITES -----------------------------------------------------------------
+
+/*!
+    @brief  Add a sprite. It appears at the next update().
+    @param  image
+            Page format image, (h + 7) / 8 pages of w bytes.
+    @param  mask
+            Page format mask of the same size, set bits mark the pixels
+            drawn; NULL to draw the whole w x h rectangle.
+    @param  w
+            Width in pixels.
+    @param  h
+            Height in pixels.
+    @param  x
+            Left column.
+    @param  y
+            Top row, any value.
+    @param  z
+            Stacking order, higher values on top; equal values stack by
+            id, lower ids below.
+    @return Sprite id, or -1 if the layer is full or out of memory.
+*/
+int8_t Adafruit_SSD1306_Sprites::add(const uint8_t *image, const uint8_t *mask,
+                                     uint8_t w, uint8_t h, int16_t x, int16_t y, uint8_t z)
+{
+    for (int8_t id = 0; id < SSD1306_SPRITES_MAX; id++) {
+        ssd1306_sprite_t *s = &sprites[id];
+        if (s->used) {
+            continue;
+        }
+        // An unaligned sprite covers one page more than its image
+        uint8_t *saved = (uint8_t *)malloc(w * ((h + 7) / 8 + 1));
+        if (!saved) {
+            return -1;
+        }
+        memset(s, 0, sizeof(*s));
+        s->image = image;
+        s->mask = mask;
+        s->w = w;
+        s->h = h;
+        s->x = x;
+        s->y = y;
+        s->z = z;
+        s->used = true;
+        s->visible = true;
+        s->changed = true;
+        s->saved = saved;
+        return id;
+    }
+    return -1;
+}
+
+/*!
+    @brief  Remove a sprite. Its background is restored at the next
+            update(), after which the id may be reused.
+    @param  id
+            Sprite id from add().
+    @return None (void).
+*/
+void Adafruit_SSD1306_Sprites::remove(int8_t id)
+{
+    if ((id >= 0) && (id < SSD1306_SPRITES_MAX) && sprites[id].used) {
+        sprites[id].visible = false;
+        sprites[id].changed = true;
+        sprites[id].image = NULL;
+    }
+}
+
+/*!
+    @brief  Move a sprite.
+    @param  id
+            Sprite id from add().
+    @param  x
+            New left column.
+    @param  y
+            New top row.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Sprites::moveTo(int8_t id, int16_t x, int16_t y)
+{
+    if ((id >= 0) && (id < SSD1306_SPRITES_MAX) && sprites[id].used &&
+        ((sprites[id].x != x) || (sprites[id].y != y))) {
+        sprites[id].x = x;
+        sprites[id].y = y;
+        sprites[id].changed = true;
+    }
+}
+
+/*!
+    @brief  Change the image of a sprite, e.g. the next animation frame.
+    @param  id
+            Sprite id from add().
+    @param  image
+            Page format image of the size given to add().
+    @param  mask
+            Matching mask, or NULL.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Sprites::setImage(int8_t id, const uint8_t *image, const uint8_t *mask)
+{
+    if ((id >= 0) && (id < SSD1306_SPRITES_MAX) && sprites[id].used && image) {
+        sprites[id].image = image;
+        sprites[id].mask = mask;
+        sprites[id].changed = true;
+    }
+}
+
+/*!
+    @brief  Show or hide a sprite.
+    @param  id
+            Sprite id from add().
+    @param  visible
+            true to show.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Sprites::setVisible(int8_t id, bool visible)
+{
+    if ((id >= 0) && (id < SSD1306_SPRITES_MAX) && sprites[id].used && sprites[id].image &&
+        (sprites[id].visible != visible)) {
+        sprites[id].visible = visible;
+        sprites[id].changed = true;
+    }
+}
+
+/*!
+    @brief  Change the stacking order of a sprite.
+    @param  id
+            Sprite id from add().
+    @param  z
+            Higher values on top.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Sprites::setZ(int8_t id, uint8_t z)
+{
+    if ((id >= 0) && (id < SSD1306_SPRITES_MAX) && sprites[id].used && (sprites[id].z != z)) {
+        sprites[id].z = z;
+        sprites[id].changed = true;
+    }
+}
+
+
+// UPDATE ------------------------------------------------------------------
+
+/*!
+    @brief  Bring the buffer up to date with the sprites and optionally
+            send the changed areas.
+    @param  flush
+            true (default) to send them with displayDirty(), false to leave
+            that to the caller, e.g. an Adafruit_SSD1306_Manager.
+    @return true if anything was redrawn.
+    @note   Changed sprites and every sprite overlapping them are erased
+            top to bottom, restoring the saved backgrounds, then drawn
+            bottom to top, saving them again.
+*/
+bool Adafruit_SSD1306_Sprites::update(bool flush)
+{
+    uint8_t order[SSD1306_SPRITES_MAX];
+    uint8_t n;
+    bool redraw[SSD1306_SPRITES_MAX];
+    bool any = false;
+
+    // Changed sprites, then everything overlapping those until stable
+    for (uint8_t i = 0; i < SSD1306_SPRITES_MAX; i++) {
+        redraw[i] = sprites[i].used && sprites[i].changed;
+        any |= redraw[i];
+    }
+    if (!any) {
+        return false;
+    }
+    for (bool grown = true; grown;) {
+        grown = false;
+        for (uint8_t i = 0; i < SSD1306_SPRITES_MAX; i++) {
+            if (!sprites[i].used || redraw[i]) {
+                continue;
+            }
+            for (uint8_t j = 0; j < SSD1306_SPRITES_MAX; j++) {
+                if (redraw[j] && overlaps(&sprites[i], &sprites[j])) {
+                    redraw[i] = grown = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Erase in the reverse of the order they were stacked in, draw in the
+    // new order
+    display->startWrite();
+    n = sort(order, true);
+    for (uint8_t k = n; k-- > 0;) {
+        if (redraw[order[k]]) {
+            erase(&sprites[order[k]]);
+        }
+    }
+    n = sort(order, false);
+    for (uint8_t k = 0; k < n; k++) {
+        ssd1306_sprite_t *s = &sprites[order[k]];
+        if (!redraw[order[k]]) {
+            continue;
+        }
+        s->changed = false;
+        if (!s->image) {
+            // Removed
+            free(s->saved);
+            memset(s, 0, sizeof(*s));
+        }
+        else if (s->visible) {
+            draw(s);
+        }
+    }
+    display->endWrite();
+
+    if (flush) {
+        display->displayDirty();
+    }
+    return true;
+}
+
+/*!
+    @brief  Forget the saved backgrounds, e.g. after the scene under the
+            sprites was redrawn or cleared. The next update() draws every
+            visible sprite over what is in the buffer then.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Sprites::invalidate(void)
+{
+    for (uint8_t i = 0; i < SSD1306_SPRITES_MAX; i++) {
+        if (sprites[i].used) {
+            sprites[i].drawn = false;
+            sprites[i].changed = true;
+        }
+    }
+}
+
+
+// DRAWING -----------------------------------------------------------------
+
+/*!
+    @brief  List the sprites bottom to top. This is a protected function,
+            not exposed.
+    @param  order
+            Receives the sprite ids.
+    @param  drawn
+            true to order by the stacking they were drawn with, false by
+            the current one.
+    @return Number of sprites listed.
+*/
+uint8_t Adafruit_SSD1306_Sprites::sort(uint8_t *order, bool drawn)
+{
+    uint8_t n = 0;
+
+    // Insertion sort, stable so equal z stack by id
+    for (uint8_t i = 0; i < SSD1306_SPRITES_MAX; i++) {
+        if (!sprites[i].used) {
+            continue;
+        }
+        uint8_t z = drawn ? sprites[i].drawnZ : sprites[i].z;
+        uint8_t j = n++;
+        while ((j > 0) && ((drawn ? sprites[order[j - 1]].drawnZ : sprites[order[j - 1]].z) > z)) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+    return n;
+}
+
+/*!
+    @brief  Check whether two sprites touch the same buffer bytes, at their
+            drawn or their new positions. This is a protected function, not
+            exposed.
+    @param  a
+            First sprite.
+    @param  b
+            Second sprite.
+    @return true if they overlap.
+    @note   Areas are rounded out to whole pages, as saved and restored.
+*/
+bool Adafruit_SSD1306_Sprites::overlaps(const ssd1306_sprite_t *a, const ssd1306_sprite_t *b)
+{
+    for (uint8_t i = 0; i < 4; i++) {
+        int16_t ax = (i & 1) ? a->drawnX : a->x;
+        int16_t ay = (i & 1) ? a->drawnY : a->y;
+        int16_t bx = (i & 2) ? b->drawnX : b->x;
+        int16_t by = (i & 2) ? b->drawnY : b->y;
+        if (((i & 1) && !a->drawn) || ((i & 2) && !b->drawn)) {
+            continue;
+        }
+        int16_t ap1 = (ay >= 0) ? ay / 8 : (ay - 7) / 8;
+        int16_t ap2 = (ay + a->h + 7 >= 0) ? (ay + a->h + 7) / 8 : 0;
+        int16_t bp1 = (by >= 0) ? by / 8 : (by - 7) / 8;
+        int16_t bp2 = (by + b->h + 7 >= 0) ? (by + b->h + 7) / 8 : 0;
+        if ((ax < bx + b->w) && (bx < ax + a->w) && (ap1 < bp2) && (bp1 < ap2)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*!
+    @brief  Put back the buffer bytes saved under a drawn sprite. This is a
+            protected function, not exposed.
+    @param  s
+            Sprite.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Sprites::erase(ssd1306_sprite_t *s)
+{
+    if (!s->drawn) {
+        return;
+    }
+    uint8_t *buffer = display->getBuffer();
+    int16_t width = (display->getRotation() & 1) ? display->height() : display->width();
+    int16_t pages = (((display->getRotation() & 1) ? display->width() : display->height()) + 7) / 8;
+    int16_t page1 = (s->drawnY >= 0) ? s->drawnY / 8 : (s->drawnY - 7) / 8;
+    int16_t count = (s->drawnY - page1 * 8 + s->h + 7) / 8;
+    int16_t c1 = (s->drawnX < 0) ? -s->drawnX : 0;
+    int16_t c2 = (s->drawnX + s->w > width) ? width - s->drawnX : s->w;
+
+    for (int16_t p = 0; p < count; p++) {
+        if ((page1 + p < 0) || (page1 + p >= pages) || (c1 >= c2)) {
+            continue;
+        }
+        memcpy(buffer + (page1 + p) * width + s->drawnX + c1, s->saved + p * s->w + c1, c2 - c1);
+    }
+    display->markDirty(s->drawnX, page1 * 8, s->w, count * 8);
+    s->drawn = false;
+}
+
+/*!
+    @brief  Save the buffer bytes under a sprite and draw it. This is a
+            protected function, not exposed.
+    @param  s
+            Sprite.
+    @return None (void).
+*/
+void Adafruit_SSD1306_Sprites::draw(ssd1306_sprite_t *s)
+{
+    uint8_t *buffer = display->getBuffer();
+    int16_t width = (display->getRotation() & 1) ? display->height() : display->width();
+    int16_t pages = (((display->getRotation() & 1) ? display->width() : display->height()) + 7) / 8;
+    int16_t page1 = (s->y >= 0) ? s->y / 8 : (s->y - 7) / 8;
+    uint8_t shift = s->y - page1 * 8;
+    int16_t count = (shift + s->h + 7) / 8;
+    int16_t imagePages = (s->h + 7) / 8;
+    int16_t c1 = (s->x < 0) ? -s->x : 0;
+    int16_t c2 = (s->x + s->w > width) ? width - s->x : s->w;
+
+    for (int16_t p = 0; p < count; p++) {
+        if ((page1 + p < 0) || (page1 + p >= pages) || (c1 >= c2)) {
+            continue;
+        }
+        uint8_t *dst = buffer + (page1 + p) * width + s->x;
+        memcpy(s->saved + p * s->w + c1, dst + c1, c2 - c1);
+        // Image page p lands shifted down here, page p - 1 spills over
+        for (int16_t c = c1; c < c2; c++) {
+            uint8_t bits = 0, mask = 0;
+            for (int8_t q = p - 1; q <= p; q++) {
+                if ((q < 0) || (q >= imagePages)) {
+                    continue;
+                }
+                int16_t rows = s->h - q * 8;
+                uint8_t m = (rows >= 8) ? 0xFF : (1 << rows) - 1;
+                uint8_t b = pgm_read_byte(&s->image[q * s->w + c]);
+                if (s->mask) {
+                    m &= pgm_read_byte(&s->mask[q * s->w + c]);
+                }
+                if (q == p) {
+                    bits |= b << shift;
+                    mask |= m << shift;
+                }
+                else if (shift) {
+                    bits |= b >> (8 - shift);
+                    mask |= m >> (8 - shift);
+                }
+            }
+            dst[c] = (dst[c] & ~mask) | (bits & mask);
+        }
+    }
+    display->markDirty(s->x, s->y, s->w, s->h);
+    s->drawnX = s->x;
+    s->drawnY = s->y;
+    s->drawnZ = s->z;
+    s->drawn = true;
+}
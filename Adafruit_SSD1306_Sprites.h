@@ -0,0 +1,72 @@
+/*!
+ * @file Adafruit_SSD1306_Sprites.h
+ *
+ * Sprite layer over an Adafruit_SSD1306 buffer.
+ *
+ * Sprites are page format images (see drawPageBitmap()) with an optional
+ * mask of the same layout. Each sprite saves the buffer bytes it covers
+ * before it is drawn and puts them back when it moves, so the scene under
+ * it never has to be redrawn. update() only touches sprites that changed
+ * and those overlapping them, in z-order, and displayDirty() sends just
+ * their old and new areas.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+#ifndef _Adafruit_SSD1306_Sprites_H_
+#define _Adafruit_SSD1306_Sprites_H_
+
+#include "Adafruit_SSD1306.h"
+
+#define SSD1306_SPRITES_MAX 8 ///< Sprites per layer
+
+/// A sprite and what it left in the buffer
+typedef struct {
+    const uint8_t *image; ///< Page format image
+    const uint8_t *mask;  ///< Page format mask, set bits are drawn; NULL for opaque
+    uint8_t w;            ///< Width in pixels
+    uint8_t h;            ///< Height in pixels
+    int16_t x;            ///< Left column, buffer coordinates
+    int16_t y;            ///< Top row, buffer coordinates
+    uint8_t z;            ///< Higher values are drawn on top
+    bool used;            ///< Slot holds a sprite
+    bool visible;         ///< Drawn at the next update()
+    bool changed;         ///< Differs from what is in the buffer
+    bool drawn;           ///< Currently drawn, saved holds the background
+    int16_t drawnX;       ///< Column it was drawn at
+    int16_t drawnY;       ///< Row it was drawn at
+    uint8_t drawnZ;       ///< Stacking order it was drawn with
+    uint8_t *saved;       ///< Buffer bytes under the sprite, w per page
+} ssd1306_sprite_t;
+
+/*!
+    @brief  Sprites with background save/restore on an Adafruit_SSD1306.
+*/
+class Adafruit_SSD1306_Sprites {
+
+public:
+    Adafruit_SSD1306_Sprites(Adafruit_SSD1306 *display);
+    ~Adafruit_SSD1306_Sprites(void);
+
+    int8_t add(const uint8_t *image, const uint8_t *mask, uint8_t w, uint8_t h,
+               int16_t x, int16_t y, uint8_t z = 0);
+    void remove(int8_t id);
+    void moveTo(int8_t id, int16_t x, int16_t y);
+    void setImage(int8_t id, const uint8_t *image, const uint8_t *mask);
+    void setVisible(int8_t id, bool visible);
+    void setZ(int8_t id, uint8_t z);
+    bool update(bool flush = true);
+    void invalidate(void);
+
+protected:
+    Adafruit_SSD1306 *display;                    ///< Display drawn into
+    ssd1306_sprite_t sprites[SSD1306_SPRITES_MAX]; ///< Sprite slots
+
+    uint8_t sort(uint8_t *order, bool drawn);
+    bool overlaps(const ssd1306_sprite_t *a, const ssd1306_sprite_t *b);
+    void erase(ssd1306_sprite_t *s);
+    void draw(ssd1306_sprite_t *s);
+};
+
+#endif // _Adafruit_SSD1306_Sprites_H_
@@ -0,0 +1,189 @@
+#include "Adafruit_SSD1306_TileMap.h"
+
+/*!
+ * @file Adafruit_SSD1306_TileMap.cpp
+ *
+ * Tile map layer with per-tile dirty flags for SSD1306 displays.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+
+// CONSTRUCTOR, DESTRUCTOR -------------------------------------------------
+
+/*!
+    @brief  Constructor for a tile map. All cells start as tile 0 and are
+            drawn at the first update().
+    @param  display
+            Display to draw into, started with begin().
+    @param  tiles
+            Tile set: 8 bytes per tile, one byte per column, least
+            significant bit on top (make_splash.py --pages output of an
+            image 8 pixels tall, one tile after the other).
+    @param  cols
+            Map width in tiles, 16 for a full 128 pixel wide display.
+    @param  rows
+            Map height in tiles, one per page.
+    @param  x
+            Left column of the map on the display, any value.
+    @param  page
+            Page of the top row of tiles, the map starts at row page * 8.
+    @return Adafruit_SSD1306_TileMap object.
+    @note   Coordinates are buffer coordinates, i.e. rotation 0.
+*/
+Adafruit_SSD1306_TileMap::Adafruit_SSD1306_TileMap(Adafruit_SSD1306 *display, const uint8_t *tiles,
+                                                   uint8_t cols, uint8_t rows,
+                                                   int16_t x, uint8_t page)
+    : display(display), tiles(tiles), cols(cols), rows(rows), x(x), page(page)
+{
+    map = (uint8_t *)calloc(cols * rows, 1);
+    dirty = (uint8_t *)malloc((cols * rows + 7) / 8);
+    if (!map || !dirty) {
+        free(map);
+        free(dirty);
+        map = NULL;
+        dirty = NULL;
+        this->cols = this->rows = 0;
+    }
+    invalidate();
+}
+
+/*!
+    @brief  Destructor for Adafruit_SSD1306_TileMap object.
+*/
+Adafruit_SSD1306_TileMap::~Adafruit_SSD1306_TileMap(void)
+{
+    free(map);
+    free(dirty);
+}
+
+
+// MAP ---------------------------------------------------------------------
+
+/*!
+    @brief  Switch to another tile set of the same layout, e.g. an inverted
+            one. Every cell is redrawn at the next update().
+    @param  tiles
+            Tile set.
+    @return None (void).
+*/
+void Adafruit_SSD1306_TileMap::setTileSet(const uint8_t *tiles)
+{
+    this->tiles = tiles;
+    invalidate();
+}
+
+/*!
+    @brief  Set the tile of a map cell.
+    @param  col
+            Cell column.
+    @param  row
+            Cell row.
+    @param  tile
+            Index into the tile set.
+    @return None (void).
+    @note   Setting a cell to the tile it already has does not mark it.
+*/
+void Adafruit_SSD1306_TileMap::setTile(uint8_t col, uint8_t row, uint8_t tile)
+{
+    if ((col >= cols) || (row >= rows)) {
+        return;
+    }
+    uint16_t i = row * cols + col;
+    if (map[i] != tile) {
+        map[i] = tile;
+        dirty[i / 8] |= 1 << (i & 7);
+    }
+}
+
+/*!
+    @brief  Get the tile of a map cell.
+    @param  col
+            Cell column.
+    @param  row
+            Cell row.
+    @return Tile index, 0 outside the map.
+*/
+uint8_t Adafruit_SSD1306_TileMap::getTile(uint8_t col, uint8_t row)
+{
+    if ((col >= cols) || (row >= rows)) {
+        return 0;
+    }
+    return map[row * cols + col];
+}
+
+/*!
+    @brief  Set every cell to one tile.
+    @param  tile
+            Index into the tile set.
+    @return None (void).
+*/
+void Adafruit_SSD1306_TileMap::fill(uint8_t tile)
+{
+    for (uint8_t row = 0; row < rows; row++) {
+        for (uint8_t col = 0; col < cols; col++) {
+            setTile(col, row, tile);
+        }
+    }
+}
+
+/*!
+    @brief  Mark every cell, so the next update() redraws the whole map,
+            e.g. after clearDisplay().
+    @return None (void).
+*/
+void Adafruit_SSD1306_TileMap::invalidate(void)
+{
+    if (dirty) {
+        memset(dirty, 0xFF, (cols * rows + 7) / 8);
+    }
+}
+
+
+// UPDATE ------------------------------------------------------------------
+
+/*!
+    @brief  Copy the changed tiles into the buffer and optionally send them.
+    @param  flush
+            true (default) to send them with displayDirty(), false to leave
+            that to the caller, e.g. an Adafruit_SSD1306_Manager.
+    @return true if any tile was copied.
+*/
+bool Adafruit_SSD1306_TileMap::update(bool flush)
+{
+    uint8_t *buffer = display->getBuffer();
+    int16_t width = (display->getRotation() & 1) ? display->height() : display->width();
+    int16_t pages = (((display->getRotation() & 1) ? display->width() : display->height()) + 7) / 8;
+    bool changed = false;
+
+    display->startWrite();
+    for (uint8_t row = 0; row < rows; row++) {
+        int16_t p = page + row;
+        for (uint8_t col = 0; col < cols; col++) {
+            uint16_t i = row * cols + col;
+            if (!(dirty[i / 8] & (1 << (i & 7)))) {
+                continue;
+            }
+            dirty[i / 8] &= ~(1 << (i & 7));
+
+            // Clip the 8 columns of the tile to the buffer
+            int16_t tx = x + col * SSD1306_TILE_SIZE;
+            int16_t c1 = (tx < 0) ? -tx : 0;
+            int16_t c2 = (tx + SSD1306_TILE_SIZE > width) ? width - tx : SSD1306_TILE_SIZE;
+            if ((p >= pages) || (c1 >= c2)) {
+                continue;
+            }
+            memcpy_P(buffer + p * width + tx + c1,
+                     tiles + map[i] * SSD1306_TILE_SIZE + c1, c2 - c1);
+            display->markDirty(tx + c1, p * 8, c2 - c1, 8);
+            changed = true;
+        }
+    }
+    display->endWrite();
+
+    if (changed && flush) {
+        display->displayDirty();
+    }
+    return changed;
+}
@@ -0,0 +1,50 @@
+/*!
+ * @file Adafruit_SSD1306_TileMap.h
+ *
+ * Tile map layer for an Adafruit_SSD1306 buffer.
+ *
+ * An 8x8 tile in the page format is exactly 8 buffer bytes, one page tall,
+ * so a map of tile indices over a tile set is rendered by copying 8 bytes
+ * per tile. Each map cell has a dirty flag: update() copies only the tiles
+ * that changed, and displayDirty() sends only those.
+ *
+ * BSD license, all text above must be included in any redistribution.
+ *
+ */
+
+#ifndef _Adafruit_SSD1306_TileMap_H_
+#define _Adafruit_SSD1306_TileMap_H_
+
+#include "Adafruit_SSD1306.h"
+
+#define SSD1306_TILE_SIZE 8 ///< Tile width and height in pixels, and bytes per tile
+
+/*!
+    @brief  Grid of 8x8 tiles drawn into an Adafruit_SSD1306 buffer.
+*/
+class Adafruit_SSD1306_TileMap {
+
+public:
+    Adafruit_SSD1306_TileMap(Adafruit_SSD1306 *display, const uint8_t *tiles,
+                             uint8_t cols, uint8_t rows, int16_t x = 0, uint8_t page = 0);
+    ~Adafruit_SSD1306_TileMap(void);
+
+    void setTileSet(const uint8_t *tiles);
+    void setTile(uint8_t col, uint8_t row, uint8_t tile);
+    uint8_t getTile(uint8_t col, uint8_t row);
+    void fill(uint8_t tile);
+    bool update(bool flush = true);
+    void invalidate(void);
+
+protected:
+    Adafruit_SSD1306 *display; ///< Display drawn into
+    const uint8_t *tiles;      ///< Tile set, 8 page format bytes per tile
+    uint8_t cols;              ///< Map width in tiles
+    uint8_t rows;              ///< Map height in tiles
+    int16_t x;                 ///< Left column of the map
+    uint8_t page;              ///< Page of the top tile row
+    uint8_t *map;              ///< Tile indices, row by row; NULL if allocation failed
+    uint8_t *dirty;            ///< One bit per map cell, same order
+};
+
+#endif // _Adafruit_SSD1306_TileMap_H_
@@ -0,0 +1,215 @@
+/**************************************************************************
+ Measurements of the ssd1306_benchmark sketch, shared with the host build
+ in test/ (make -C test bench) so hot-path regressions show up in CI
+ without a board.
+
+ runBenchmarks() starts the display on an Adafruit_SSD1306_Emulator and
+ prints the drawing, bus traffic and bus model tables with BENCH_PRINTF,
+ Serial.printf unless defined before including this file.
+
+ BSD license, check license.txt for more information
+ **************************************************************************/
+
+#ifndef _BENCHMARK_H_
+#define _BENCHMARK_H_
+
+#include <stdio.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+#include <Adafruit_SSD1306_Emulator.h>
+#include <Adafruit_SSD1306_BusModel.h>
+#include "esp_timer.h"
+
+#ifndef BENCH_PRINTF
+#define BENCH_PRINTF Serial.printf ///< printf-like output of the tables
+#endif
+
+#define SCREEN_WIDTH 128 // OLED display width, in pixels
+#define SCREEN_HEIGHT 64 // OLED display height, in pixels
+#define SCREEN_ADDRESS 0x3C
+
+Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, I2C_NUM_0);
+Adafruit_SSD1306_Emulator emulator(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+#define PIXEL_OPS 20000 // drawPixel/getPixel calls per measurement
+#define SHAPE_OPS 500   // Shape primitive calls per measurement
+
+static volatile bool sink; // Keeps getPixel() results alive
+
+static void report(const char *name, int64_t us, uint32_t ops) {
+  BENCH_PRINTF("%-28s %8lu ns/op\n", name, (unsigned long)(us * 1000 / ops));
+}
+
+static void reportTraffic(const char *name, uint32_t frames) {
+  const ssd1306_emu_counters_t *c = emulator.getCounters();
+  BENCH_PRINTF("%-28s %6lu B/frame %5lu tx/frame (%lu frames)\n", name,
+               (unsigned long)(c->bytes / frames),
+               (unsigned long)(c->transactions / frames),
+               (unsigned long)frames);
+  emulator.resetCounters();
+}
+
+static void benchPixels(void) {
+  char name[32];
+
+  for (uint8_t r = 0; r < 4; r++) {
+    display.setRotation(r);
+    int16_t w = display.width(), h = display.height();
+    int64_t t0 = esp_timer_get_time();
+    for (uint32_t i = 0; i < PIXEL_OPS; i++) {
+      display.drawPixel(i % w, (i / w) % h, SSD1306_INVERSE);
+    }
+    snprintf(name, sizeof(name), "drawPixel rotation %u", r);
+    report(name, esp_timer_get_time() - t0, PIXEL_OPS);
+  }
+  display.setRotation(0);
+
+  int64_t t0 = esp_timer_get_time();
+  for (uint32_t i = 0; i < PIXEL_OPS; i++) {
+    sink = display.getPixel(i % SCREEN_WIDTH, (i / SCREEN_WIDTH) % SCREEN_HEIGHT);
+  }
+  report("getPixel", esp_timer_get_time() - t0, PIXEL_OPS);
+
+  t0 = esp_timer_get_time();
+  for (uint32_t i = 0; i < SHAPE_OPS; i++) {
+    display.clearDisplay();
+  }
+  report("clearDisplay", esp_timer_get_time() - t0, SHAPE_OPS);
+}
+
+static void benchShapes(void) {
+  int64_t t0 = esp_timer_get_time();
+  for (uint32_t i = 0; i < SHAPE_OPS; i++) {
+    display.drawLine(0, i % SCREEN_HEIGHT, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1 - i % SCREEN_HEIGHT, SSD1306_INVERSE);
+  }
+  report("drawLine (diagonal)", esp_timer_get_time() - t0, SHAPE_OPS);
+
+  t0 = esp_timer_get_time();
+  for (uint32_t i = 0; i < SHAPE_OPS; i++) {
+    display.drawFastHLine(0, i % SCREEN_HEIGHT, SCREEN_WIDTH, SSD1306_INVERSE);
+  }
+  report("drawFastHLine (full width)", esp_timer_get_time() - t0, SHAPE_OPS);
+
+  t0 = esp_timer_get_time();
+  for (uint32_t i = 0; i < SHAPE_OPS; i++) {
+    display.drawFastVLine(i % SCREEN_WIDTH, 0, SCREEN_HEIGHT, SSD1306_INVERSE);
+  }
+  report("drawFastVLine (full height)", esp_timer_get_time() - t0, SHAPE_OPS);
+
+  t0 = esp_timer_get_time();
+  for (uint32_t i = 0; i < SHAPE_OPS; i++) {
+    display.drawRect(i % 32, i % 16, 64, 32, SSD1306_INVERSE);
+  }
+  report("drawRect 64x32", esp_timer_get_time() - t0, SHAPE_OPS);
+
+  t0 = esp_timer_get_time();
+  for (uint32_t i = 0; i < SHAPE_OPS; i++) {
+    display.fillRect(i % 32, i % 16, 64, 32, SSD1306_INVERSE);
+  }
+  report("fillRect 64x32", esp_timer_get_time() - t0, SHAPE_OPS);
+
+  t0 = esp_timer_get_time();
+  for (uint32_t i = 0; i < SHAPE_OPS; i++) {
+    display.drawCircle(64, 32, 8 + i % 24, SSD1306_INVERSE);
+  }
+  report("drawCircle r8..31", esp_timer_get_time() - t0, SHAPE_OPS);
+
+  t0 = esp_timer_get_time();
+  for (uint32_t i = 0; i < SHAPE_OPS; i++) {
+    display.fillCircle(64, 32, 8 + i % 24, SSD1306_INVERSE);
+  }
+  report("fillCircle r8..31", esp_timer_get_time() - t0, SHAPE_OPS);
+
+  for (uint8_t size = 1; size <= 3; size++) {
+    char name[32];
+    display.setTextSize(size);
+    display.setTextColor(SSD1306_INVERSE);
+    t0 = esp_timer_get_time();
+    for (uint32_t i = 0; i < SHAPE_OPS; i++) {
+      display.setCursor(0, 0);
+      display.print(F("Hello"));
+    }
+    snprintf(name, sizeof(name), "print 5 chars, size %u", size);
+    report(name, esp_timer_get_time() - t0, SHAPE_OPS);
+  }
+}
+
+// Line pattern of testdrawline(), one update per line
+static uint32_t workloadLines(bool dirtyOnly) {
+  uint32_t frames = 0;
+
+  display.clearDisplay();
+  for (int16_t i = 0; i < display.width(); i += 4, frames++) {
+    display.drawLine(0, 0, i, display.height() - 1, SSD1306_WHITE);
+    dirtyOnly ? display.displayDirty() : display.display();
+  }
+  for (int16_t i = 0; i < display.height(); i += 4, frames++) {
+    display.drawLine(0, 0, display.width() - 1, i, SSD1306_WHITE);
+    dirtyOnly ? display.displayDirty() : display.display();
+  }
+  return frames;
+}
+
+// Rectangle pattern of testfillrect(), one update per rectangle
+static uint32_t workloadRects(bool dirtyOnly) {
+  uint32_t frames = 0;
+
+  display.clearDisplay();
+  for (int16_t i = 0; i < display.height() / 2; i += 3, frames++) {
+    display.fillRect(i, i, display.width() - i * 2, display.height() - i * 2, SSD1306_INVERSE);
+    dirtyOnly ? display.displayDirty() : display.display();
+  }
+  return frames;
+}
+
+static void benchTraffic(void) {
+  emulator.resetCounters();
+  reportTraffic("testdrawline, display()", workloadLines(false));
+  reportTraffic("testdrawline, displayDirty()", workloadLines(true));
+  reportTraffic("testfillrect, display()", workloadRects(false));
+  reportTraffic("testfillrect, displayDirty()", workloadRects(true));
+
+  int64_t t0 = esp_timer_get_time();
+  for (uint32_t i = 0; i < SHAPE_OPS; i++) {
+    display.display();
+  }
+  report("display() CPU, emulated bus", esp_timer_get_time() - t0, SHAPE_OPS);
+  emulator.resetCounters();
+}
+
+static void benchModel(void) {
+  static const uint8_t geometries[][2] = { { 128, 64 }, { 128, 32 }, { 96, 16 } };
+  static const uint32_t clocks[] = { 100000, 400000, 1000000 };
+
+  for (uint8_t c = 0; c < 3; c++) {
+    Adafruit_SSD1306_BusModel model(clocks[c]);
+    for (uint8_t g = 0; g < 3; g++) {
+      ssd1306_bus_time_t t = model.display(geometries[g][0], geometries[g][1]);
+      BENCH_PRINTF("%4lu kHz %3ux%-2u display()  %6lu us (%lu us overhead), max %lu fps\n",
+                   (unsigned long)(clocks[c] / 1000), geometries[g][0], geometries[g][1],
+                   (unsigned long)t.totalUs, (unsigned long)t.overheadUs,
+                   (unsigned long)model.maxFps(geometries[g][0], geometries[g][1]));
+    }
+  }
+}
+
+// Returns false if the display could not be started
+static bool runBenchmarks(void) {
+  display.setTransport(Adafruit_SSD1306_Emulator::transport, &emulator);
+  if (!display.begin(SCREEN_ADDRESS)) {
+    return false;
+  }
+
+  BENCH_PRINTF("\n--- Drawing (CPU only) ---\n");
+  benchPixels();
+  benchShapes();
+
+  BENCH_PRINTF("\n--- Bus traffic per update ---\n");
+  benchTraffic();
+
+  BENCH_PRINTF("\n--- Bus model ---\n");
+  benchModel();
+  return true;
+}
+
+#endif // _BENCHMARK_H_
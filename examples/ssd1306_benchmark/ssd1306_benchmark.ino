@@ -0,0 +1,62 @@
+/**************************************************************************
+ Benchmark for the SSD1306 library hot paths.
+
+ Measures the CPU cost of the drawing primitives (ns per call, drawPixel
+ in all four rotations) and the bus traffic generated per display() for
+ the line and rectangle patterns of the other examples, full frame vs.
+ changed areas only.
+
+ All traffic goes to an Adafruit_SSD1306_Emulator, so no display needs
+ to be connected and the timings are pure CPU. Define BENCH_I2C_SDA and
+ BENCH_I2C_SCL to also time display() on a real panel.
+
+ Run the same sketch before and after a change to the library and compare
+ the printed tables. The bus model section predicts the wire time of an
+ update at the usual I2C clocks. The measurements live in benchmark.h,
+ which test/ also builds for the host (make -C test bench).
+
+ BSD license, check license.txt for more information
+ **************************************************************************/
+
+#include "benchmark.h"
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!runBenchmarks()) {
+    Serial.println(F("SSD1306 allocation failed"));
+    for (;;); // Don't proceed, loop forever
+  }
+
+#if defined(BENCH_I2C_SDA) && defined(BENCH_I2C_SCL)
+  i2c_config_t conf = {};
+  conf.mode = I2C_MODE_MASTER;
+  conf.sda_io_num = BENCH_I2C_SDA;
+  conf.scl_io_num = BENCH_I2C_SCL;
+  conf.sda_pullup_en = GPIO_PULLUP_ENABLE;
+  conf.scl_pullup_en = GPIO_PULLUP_ENABLE;
+  conf.master.clk_speed = 400000;
+  i2c_param_config(I2C_NUM_0, &conf);
+  i2c_driver_install(I2C_NUM_0, conf.mode, 0, 0, 0);
+
+  display.setTransport(NULL, NULL);
+  display.resetStats();
+  for (uint32_t i = 0; i < 50; i++) {
+    display.display();
+  }
+  const ssd1306_stats_t *stats = display.getStats();
+  Serial.printf("\n%-28s %8lu us last, %lu us max, %lu failures\n",
+                "display() on I2C, 400 kHz", (unsigned long)stats->lastDisplayUs,
+                (unsigned long)stats->maxDisplayUs, (unsigned long)stats->failures);
+
+  // Predicted vs. measured: the difference is driver and CPU time
+  Adafruit_SSD1306_BusModel model(conf.master.clk_speed);
+  ssd1306_bus_time_t t = model.fromStats(stats);
+  Serial.printf("%-28s %8lu us per display(), %lu us of it protocol overhead\n",
+                "bus model prediction", (unsigned long)(t.totalUs / stats->displays),
+                (unsigned long)(t.overheadUs / stats->displays));
+#endif
+}
+
+void loop() {
+}
@@ -0,0 +1,186 @@
+/**************************************************************************
+ Reference checks shared by the golden scene and the host tests in test/.
+
+ A check draws the same content twice: with the code under test on a
+ display whose traffic goes to an Adafruit_SSD1306_Emulator, and with a
+ slow but obvious reference -- drawPixel() on a second display, or an
+ Adafruit GFX canvas. goldenMatches() compares the two pixel by pixel and
+ also compares the emulated panel with the display buffer, so the dirty
+ areas sent by displayDirty() are checked along with the drawing.
+
+ Results are written as "# check" lines, which pbm_compare.py skips.
+
+ BSD license, check license.txt for more information
+ **************************************************************************/
+
+#ifndef _GOLDEN_CHECK_H_
+#define _GOLDEN_CHECK_H_
+
+#include <stdio.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+#include <Adafruit_SSD1306_Emulator.h>
+
+// Pseudo-random numbers, the same on every platform (xorshift32)
+static inline uint32_t goldenRandom(uint32_t *state) {
+  uint32_t x = *state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return *state = x;
+}
+
+// Fills the whole buffer with random pixels and flags it as changed
+static inline void goldenNoise(Adafruit_SSD1306 &display, uint32_t seed) {
+  uint8_t *buffer = display.getBuffer();
+  int16_t w = (display.getRotation() & 1) ? display.height() : display.width();
+  int16_t h = (display.getRotation() & 1) ? display.width() : display.height();
+
+  seed |= 1;
+  for (int16_t i = 0; i < w * ((h + 7) / 8); i++) {
+    buffer[i] = goldenRandom(&seed);
+  }
+  display.markDirty();
+}
+
+// True if the display shows what reference.getPixel() reports for every
+// pixel, in rotated coordinates, and the panel matches the buffer. On a
+// mismatch x and y are set to the first differing pixel, in the display's
+// rotated coordinates, or to -1 if only the panel differs.
+template <class Reference>
+static bool goldenMatches(Adafruit_SSD1306 &display, Adafruit_SSD1306_Emulator &emulator,
+                          Reference &reference, int16_t *x, int16_t *y) {
+  for (*y = 0; *y < display.height(); (*y)++) {
+    for (*x = 0; *x < display.width(); (*x)++) {
+      if (display.getPixel(*x, *y) != (bool)reference.getPixel(*x, *y)) {
+        return false;
+      }
+    }
+  }
+
+  const uint8_t *buffer = display.getBuffer();
+  int16_t w = (display.getRotation() & 1) ? display.height() : display.width();
+  int16_t h = (display.getRotation() & 1) ? display.width() : display.height();
+  *x = *y = -1;
+  for (int16_t py = 0; py < h; py++) {
+    for (int16_t px = 0; px < w; px++) {
+      if (emulator.getPixel(px, py) != (bool)((buffer[(py / 8) * w + px] >> (py & 7)) & 1)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Fills a bitmap with pseudo-random bytes
+static inline void goldenBitmap(uint8_t *bitmap, size_t len, uint32_t seed) {
+  seed |= 1;
+  for (size_t i = 0; i < len; i++) {
+    bitmap[i] = goldenRandom(&seed);
+  }
+}
+
+// Placements of the drawing checks on a w x h display: page aligned and
+// not, whole and partial bytes, clipped at each edge and at all of them
+#define GOLDEN_RECTS 9
+static inline void goldenRect(uint8_t i, int16_t w, int16_t h, int16_t *r) {
+  const int rects[GOLDEN_RECTS][4] = {
+    { 8, 8, 16, 16 },         // Page aligned, whole bytes
+    { 5, 0, 13, 9 },          // Page aligned, partial bytes
+    { 3, 5, 16, 12 },         // Unaligned
+    { 1, 3, 21, 3 },          // Inside one page
+    { -5, 3, 21, 10 },        // Clipped left
+    { w - 10, 8, 24, 8 },     // Clipped right
+    { 10, -11, 13, 24 },      // Clipped top
+    { 12, h - 5, 11, 16 },    // Clipped bottom
+    { -3, -3, w + 6, h + 6 }, // Clipped everywhere
+  };
+  for (uint8_t k = 0; k < 4; k++) {
+    r[k] = rects[i][k];
+  }
+}
+
+// Writes the result of a check, step is the failing case or -1, returns ok
+static inline bool goldenReport(ssd1306_emu_writer_t writer, void *context, const char *name,
+                                int step, Adafruit_SSD1306 &display, bool ok, int16_t x,
+                                int16_t y) {
+  int16_t w = (display.getRotation() & 1) ? display.height() : display.width();
+  int16_t h = (display.getRotation() & 1) ? display.width() : display.height();
+  char line[112];
+  int n;
+
+  if (ok) {
+    n = snprintf(line, sizeof(line), "# check %s %dx%d r%u: ok\n", name, w, h,
+                 display.getRotation());
+  } else if (x < 0) {
+    n = snprintf(line, sizeof(line), "# check %s %dx%d r%u #%d: FAILED, panel differs from buffer\n",
+                 name, w, h, display.getRotation(), step);
+  } else {
+    n = snprintf(line, sizeof(line), "# check %s %dx%d r%u #%d: FAILED at (%d, %d)\n", name, w,
+                 h, display.getRotation(), step, x, y);
+  }
+  writer(context, (const uint8_t *)line, (n < (int)sizeof(line)) ? n : sizeof(line) - 1);
+  return ok;
+}
+
+// A display under test and a reference display of the same geometry. A
+// check runs several cases, each between start() and finish(), and
+// report() writes its result: one line if all passed, else one per
+// failed case.
+class GoldenPair {
+
+public:
+  GoldenPair(uint8_t w, uint8_t h)
+      : display(w, h, I2C_NUM_0), reference(w, h, I2C_NUM_0), emulator(w, h), sink(w, h),
+        step(0), passed(true) {
+    display.setTransport(Adafruit_SSD1306_Emulator::transport, &emulator);
+    reference.setTransport(Adafruit_SSD1306_Emulator::transport, &sink);
+  }
+
+  // Returns false if a buffer could not be allocated
+  bool begin(void) {
+    return display.begin(0x3C) && reference.begin(0x3C);
+  }
+
+  // Gives both displays the same random content and rotation, and sends
+  // the display under test to its panel in full
+  void start(uint8_t rotation, uint32_t seed) {
+    display.setRotation(rotation);
+    reference.setRotation(rotation);
+    goldenNoise(display, seed);
+    goldenNoise(reference, seed);
+    display.display();
+    step++;
+  }
+
+  // Sends the changes with displayDirty() and compares both displays
+  bool finish(ssd1306_emu_writer_t writer, void *context, const char *name) {
+    int16_t x, y;
+    display.displayDirty();
+    if (goldenMatches(display, emulator, reference, &x, &y)) {
+      return true;
+    }
+    passed = goldenReport(writer, context, name, step, display, false, x, y);
+    return false;
+  }
+
+  // Writes the result of the cases since the last report(), returns it
+  bool report(ssd1306_emu_writer_t writer, void *context, const char *name) {
+    bool ok = passed;
+    if (ok) {
+      goldenReport(writer, context, name, -1, display, true, 0, 0);
+    }
+    step = 0;
+    passed = true;
+    return ok;
+  }
+
+  Adafruit_SSD1306 display;            // Code under test
+  Adafruit_SSD1306 reference;          // Drawn with the reference
+  Adafruit_SSD1306_Emulator emulator;  // Panel of the display under test
+  Adafruit_SSD1306_Emulator sink;      // Panel of the reference, unused
+  int step;                            // Case of the running check
+  bool passed;                         // No case failed since report()
+};
+
+#endif // _GOLDEN_CHECK_H_
@@ -0,0 +1,504 @@
+/**************************************************************************
+ Test scene of the golden-image check, shared by the ssd1306_golden sketch
+ and the host test in test/ (make -C test).
+
+ renderGoldens() draws the scene for every supported geometry (128x64,
+ 128x32, 96x16) and rotation through an Adafruit_SSD1306_Emulator, once
+ with display() and once more after a partial update with displayDirty(),
+ and writes what the emulated panel shows as named plain PBM images.
+ Single images on 128x64 follow for the page format text of
+ golden_font.h, a font with kerning pairs, for the readouts of
+ Adafruit_SSD1306_Number in that font, and for Adafruit_SSD1306_Chart in
+ each style.
+
+ The images hold only drawing done by the library itself, so they do not
+ change with the Adafruit GFX version. runChecks()
+ covers the rest: lines, circles, bitmaps and text rendered by GFX are
+ compared with a GFXcanvas1 given the same calls, and the byte-wise
+ drawing functions of the library with a per-pixel reference, for every
+ placement of golden_check.h, color and rotation.
+
+ BSD license, check license.txt for more information
+ **************************************************************************/
+
+#ifndef _GOLDEN_SCENE_H_
+#define _GOLDEN_SCENE_H_
+
+#include "golden_check.h"
+#include "golden_font.h"
+#include <Adafruit_SSD1306_Number.h>
+#include <Adafruit_SSD1306_Chart.h>
+
+static const uint8_t golden_geometries[][2] = { { 128, 64 }, { 128, 32 }, { 96, 16 } };
+
+#define LOGO_HEIGHT   16
+#define LOGO_WIDTH    16
+static const unsigned char PROGMEM logo_bmp[] =
+{ 0b00000000, 0b11000000,
+  0b00000001, 0b11000000,
+  0b00000001, 0b11000000,
+  0b00000011, 0b11100000,
+  0b11110011, 0b11100000,
+  0b11111110, 0b11111000,
+  0b01111110, 0b11111111,
+  0b00110011, 0b10011111,
+  0b00011111, 0b11111100,
+  0b00001101, 0b01110000,
+  0b00011011, 0b10100000,
+  0b00111111, 0b11100000,
+  0b00111111, 0b11110000,
+  0b01111100, 0b11110000,
+  0b01110000, 0b01110000,
+  0b00000000, 0b00110000 };
+
+static void drawScene(Adafruit_SSD1306 &display) {
+  int16_t w = display.width(), h = display.height();
+
+  display.clearDisplay();
+  display.drawRect(1, 1, w - 2, h - 2, SSD1306_WHITE);
+  display.fillRect(w / 4, h / 4, w / 2, h / 2, SSD1306_INVERSE);
+  display.drawFastVLine(w / 3, 0, h, SSD1306_INVERSE);
+  display.drawFastHLine(0, h / 3, w, SSD1306_INVERSE);
+  display.drawRowMajorBitmap(w - LOGO_WIDTH - 2, 2, logo_bmp, LOGO_WIDTH, LOGO_HEIGHT,
+                             SSD1306_INVERSE);
+  display.drawPixel(0, h - 1, SSD1306_WHITE);
+  display.drawPixel(w - 1, 0, SSD1306_WHITE);
+}
+
+// Drawing left to Adafruit GFX, checked against a canvas. WHITE only, a
+// GFXcanvas1 sets pixels drawn with INVERSE.
+static void drawGfxScene(Adafruit_GFX &gfx) {
+  int16_t w = gfx.width(), h = gfx.height();
+
+  for (int16_t i = 0; i < w; i += 8) {
+    gfx.drawLine(0, 0, i, h - 1, SSD1306_WHITE);
+  }
+  gfx.drawCircle(w / 2, h / 2, h / 3, SSD1306_WHITE);
+  gfx.fillCircle(w - 6, h - 6, 4, SSD1306_WHITE);
+  gfx.drawBitmap(w - LOGO_WIDTH - 2, 2, logo_bmp, LOGO_WIDTH, LOGO_HEIGHT, SSD1306_WHITE);
+  gfx.setTextSize(1);
+  gfx.setTextColor(SSD1306_WHITE);
+  gfx.setCursor(2, 2);
+  gfx.print(F("Ag09"));
+}
+
+// Partial update on top of a full one, exercises the address windows
+static void drawUpdate(Adafruit_SSD1306 &display) {
+  display.fillRect(3, display.height() / 2 - 3, 9, 7, SSD1306_INVERSE);
+  display.drawFastHLine(0, display.height() - 2, display.width() / 3, SSD1306_WHITE);
+}
+
+// Kerned page format text: transparent over a page aligned block, opaque
+// at an unaligned row with a second line, and skipping a missing and a
+// blank glyph
+static void drawTextScene(Adafruit_SSD1306 &display) {
+  display.fillRect(0, 0, 64, 32, SSD1306_WHITE);
+  display.drawPageText(2, 0, &golden_font, "-1.17", SSD1306_INVERSE);
+  display.drawPageText(66, 5, &golden_font, "11\n7.1", SSD1306_WHITE, SSD1306_BLACK);
+  display.drawPageText(4, 37, &golden_font, "7.x-1/1", SSD1306_WHITE);
+}
+
+// Number readouts updated from a first value to the sign, the decimal
+// point with leading zeros, and the overflow dashes, positive and negative,
+// at an unaligned row and in inverted colors
+static void drawNumberScene(Adafruit_SSD1306 &display) {
+  Adafruit_SSD1306_Number sign(&display, &golden_font, 0, 0, 4, 1);
+  Adafruit_SSD1306_Number over(&display, &golden_font, 72, 0, 3, 1);
+  Adafruit_SSD1306_Number zeros(&display, &golden_font, 0, 29, 4, 2);
+  Adafruit_SSD1306_Number under(&display, &golden_font, 72, 29, 3);
+
+  zeros.setColor(SSD1306_BLACK, SSD1306_WHITE);
+  sign.setValue(888);
+  over.setValue(999);
+  zeros.setValue(1234);
+  under.setValue(5);
+  sign.update();
+  over.update();
+  zeros.update();
+  under.update();
+
+  sign.setValue(-95);   // " -9.5"
+  over.setValue(1234);  // "--.-"
+  zeros.setValue(-7);   // "-0.07"
+  under.setValue(-100); // "---"
+  sign.update();
+  over.update();
+  zeros.update();
+  under.update();
+}
+
+// Charts scrolled by more samples than their width, so the oldest columns
+// have left on the left: a wave clamped at both ends of the range with
+// steps and spikes, and a small chart in inverted colors
+static void drawChartScene(Adafruit_SSD1306 &display, uint8_t style) {
+  Adafruit_SSD1306_Chart wave(&display, 2, 1, 100, 5, -50, 50);
+  Adafruit_SSD1306_Chart small(&display, 106, 0, 20, 2, 0, 15);
+
+  wave.setStyle(style);
+  small.setStyle(style);
+  small.setColor(SSD1306_BLACK, SSD1306_WHITE);
+  wave.clear();
+  small.clear();
+  for (int16_t i = 0; i < 250; i++) {
+    int32_t v = (i * 7) % 140 - 70;
+    if (i % 37 == 0) {
+      v = -v;
+    }
+    wave.addSample((i / 60 & 1) ? v : v / 2);
+    small.addSample(i % 17);
+  }
+}
+
+static void drawChartLines(Adafruit_SSD1306 &display) {
+  drawChartScene(display, SSD1306_CHART_LINE);
+}
+
+static void drawChartDots(Adafruit_SSD1306 &display) {
+  drawChartScene(display, SSD1306_CHART_DOTS);
+}
+
+static void drawChartBars(Adafruit_SSD1306 &display) {
+  drawChartScene(display, SSD1306_CHART_BARS);
+}
+
+// Draws a scene on a cleared 128x64 display after a full update, sends it
+// with displayDirty() and writes the panel as one image. Returns false if
+// the display could not be started.
+static bool renderSingle(ssd1306_emu_writer_t writer, void *context, const char *name,
+                         void (*draw)(Adafruit_SSD1306 &display)) {
+  Adafruit_SSD1306 display(128, 64, I2C_NUM_0);
+  Adafruit_SSD1306_Emulator emulator(128, 64);
+
+  display.setTransport(Adafruit_SSD1306_Emulator::transport, &emulator);
+  if (!display.begin(0x3C)) {
+    return false;
+  }
+  display.clearDisplay();
+  display.display();
+  draw(display);
+  display.displayDirty();
+  emulator.writePBM(writer, context, name, true);
+  return true;
+}
+
+// Returns false if a display could not be started
+static bool renderGoldens(ssd1306_emu_writer_t writer, void *context) {
+  for (uint8_t g = 0; g < sizeof(golden_geometries) / sizeof(golden_geometries[0]); g++) {
+    uint8_t w = golden_geometries[g][0], h = golden_geometries[g][1];
+    Adafruit_SSD1306 display(w, h, I2C_NUM_0);
+    Adafruit_SSD1306_Emulator emulator(w, h);
+
+    display.setTransport(Adafruit_SSD1306_Emulator::transport, &emulator);
+    if (!display.begin(0x3C)) {
+      return false;
+    }
+
+    for (uint8_t r = 0; r < 4; r++) {
+      char name[32];
+      display.setRotation(r);
+
+      drawScene(display);
+      display.display();
+      snprintf(name, sizeof(name), "%ux%u_r%u_full", w, h, r);
+      emulator.writePBM(writer, context, name, true);
+
+      drawUpdate(display);
+      display.displayDirty();
+      snprintf(name, sizeof(name), "%ux%u_r%u_dirty", w, h, r);
+      emulator.writePBM(writer, context, name, true);
+    }
+  }
+  return renderSingle(writer, context, "128x64_text", drawTextScene) &&
+         renderSingle(writer, context, "128x64_number", drawNumberScene) &&
+         renderSingle(writer, context, "128x64_chart_line", drawChartLines) &&
+         renderSingle(writer, context, "128x64_chart_dots", drawChartDots) &&
+         renderSingle(writer, context, "128x64_chart_bars", drawChartBars);
+}
+
+static const uint16_t golden_colors[] = { SSD1306_WHITE, SSD1306_BLACK, SSD1306_INVERSE };
+
+// Scratch bitmap of the checks, large enough for the "clipped everywhere"
+// placement on 128x64 in any rotation and bitmap layout, and for a bit
+// per pixel of it
+#define GOLDEN_BITMAP_BYTES (((128 + 6 + 7) / 8) * (128 + 6))
+
+// Adafruit GFX drawing against a GFXcanvas1 given the same calls
+static void checkGfx(GoldenPair &pair, uint8_t w, uint8_t h, uint8_t rotation,
+                     ssd1306_emu_writer_t writer, void *context) {
+  GFXcanvas1 canvas(w, h);
+  int16_t x, y;
+
+  pair.start(rotation, 1);
+  canvas.setRotation(rotation);
+  pair.display.clearDisplay();
+  drawGfxScene(pair.display);
+  drawGfxScene(canvas);
+  pair.display.displayDirty();
+  if (!goldenMatches(pair.display, pair.emulator, canvas, &x, &y)) {
+    pair.passed = goldenReport(writer, context, "gfx", pair.step, pair.display, false, x, y);
+  }
+}
+
+// drawRowMajorBitmap() against Adafruit GFX drawBitmap()
+static void checkRowMajorBitmap(GoldenPair &pair, uint8_t rotation, uint8_t *bitmap,
+                                ssd1306_emu_writer_t writer, void *context) {
+  for (uint8_t i = 0; i < GOLDEN_RECTS; i++) {
+    for (uint8_t c = 0; c < 3; c++) {
+      int16_t r[4];
+      pair.start(rotation, i * 3 + c);
+      goldenRect(i, pair.display.width(), pair.display.height(), r);
+      goldenBitmap(bitmap, ((r[2] + 7) / 8) * r[3], pair.step);
+      pair.display.drawRowMajorBitmap(r[0], r[1], bitmap, r[2], r[3], golden_colors[c]);
+      pair.reference.drawBitmap(r[0], r[1], bitmap, r[2], r[3], golden_colors[c]);
+      pair.finish(writer, context, "rowmajor");
+    }
+  }
+}
+
+// Reference of the page format bitmap functions, a drawPixel() per pixel
+static void goldenPageBitmap(Adafruit_SSD1306 &display, int16_t x, int16_t y,
+                             const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color,
+                             uint16_t bg, bool opaque) {
+  for (int16_t j = 0; j < h; j++) {
+    for (int16_t i = 0; i < w; i++) {
+      bool set = (bitmap[(j / 8) * w + i] >> (j & 7)) & 1;
+      if (set || opaque) {
+        display.drawPixel(x + i, y + j, set ? color : bg);
+      }
+    }
+  }
+}
+
+// drawPageBitmap(), transparent and opaque, against drawPixel()
+static void checkPageBitmap(GoldenPair &pair, uint8_t rotation, uint8_t *bitmap,
+                            ssd1306_emu_writer_t writer, void *context) {
+  // Color and bg of the opaque cases; white on black is a memcpy_P() when
+  // page aligned, the others mask and shift
+  static const uint16_t opaque[][2] = { { SSD1306_WHITE, SSD1306_BLACK },
+                                        { SSD1306_BLACK, SSD1306_WHITE },
+                                        { SSD1306_INVERSE, SSD1306_WHITE },
+                                        { SSD1306_WHITE, SSD1306_INVERSE } };
+
+  for (uint8_t i = 0; i < GOLDEN_RECTS; i++) {
+    for (uint8_t c = 0; c < 3 + 4; c++) {
+      int16_t r[4];
+      pair.start(rotation, 100 + i * 7 + c);
+      goldenRect(i, pair.display.width(), pair.display.height(), r);
+      goldenBitmap(bitmap, r[2] * ((r[3] + 7) / 8), pair.step);
+      if (c < 3) {
+        pair.display.drawPageBitmap(r[0], r[1], bitmap, r[2], r[3], golden_colors[c]);
+        goldenPageBitmap(pair.reference, r[0], r[1], bitmap, r[2], r[3], golden_colors[c],
+                         golden_colors[c], false);
+      } else {
+        const uint16_t *colors = opaque[c - 3];
+        pair.display.drawPageBitmap(r[0], r[1], bitmap, r[2], r[3], colors[0], colors[1]);
+        goldenPageBitmap(pair.reference, r[0], r[1], bitmap, r[2], r[3], colors[0], colors[1],
+                         true);
+      }
+      pair.finish(writer, context, "pagebitmap");
+    }
+  }
+}
+
+// Moves of the copy and scroll checks: whole pages and less, in every
+// direction, most of them overlapping the source
+static const int8_t golden_moves[][2] = { { 0, 8 },  { 0, -8 }, { 0, 16 }, { 0, -16 },
+                                          { 0, 3 },  { 0, -3 }, { 0, 11 }, { 0, -13 },
+                                          { 5, 0 },  { -5, 0 }, { 7, 3 },  { -6, -9 },
+                                          { 3, -8 }, { -2, 8 } };
+#define GOLDEN_MOVES (sizeof(golden_moves) / sizeof(golden_moves[0]))
+
+static bool goldenInside(Adafruit_SSD1306 &display, int16_t x, int16_t y) {
+  return (x >= 0) && (y >= 0) && (x < display.width()) && (y < display.height());
+}
+
+// Reference of copyRect(): reads every source pixel before writing any,
+// copies the pixels whose source and destination are both on the display
+static void goldenCopyRect(Adafruit_SSD1306 &display, uint8_t *scratch, int16_t sx, int16_t sy,
+                           int16_t w, int16_t h, int16_t dx, int16_t dy) {
+  for (int32_t k = 0; k < (int32_t)w * h; k++) {
+    bool set = display.getPixel(sx + k % w, sy + k / w);
+    scratch[k / 8] = set ? (scratch[k / 8] | (1 << (k & 7))) : (scratch[k / 8] & ~(1 << (k & 7)));
+  }
+  for (int32_t k = 0; k < (int32_t)w * h; k++) {
+    int16_t i = k % w, j = k / w;
+    if (goldenInside(display, sx + i, sy + j) && goldenInside(display, dx + i, dy + j)) {
+      display.drawPixel(dx + i, dy + j,
+                        ((scratch[k / 8] >> (k & 7)) & 1) ? SSD1306_WHITE : SSD1306_BLACK);
+    }
+  }
+}
+
+// Reference of scrollRegion(): each pixel of the region on the display
+// takes the old value of the pixel dx, dy before it, or color if that one
+// is outside the region
+static void goldenScrollRegion(Adafruit_SSD1306 &display, uint8_t *scratch, int16_t x, int16_t y,
+                               int16_t w, int16_t h, int16_t dx, int16_t dy, uint16_t color) {
+  int16_t x1 = max(x, (int16_t)0), y1 = max(y, (int16_t)0);
+  int16_t x2 = min((int16_t)(x + w), display.width());
+  int16_t y2 = min((int16_t)(y + h), display.height());
+
+  for (int16_t j = y1; j < y2; j++) {
+    for (int16_t i = x1; i < x2; i++) {
+      int32_t k = (int32_t)(j - y1) * (x2 - x1) + (i - x1);
+      bool set = display.getPixel(i, j);
+      scratch[k / 8] = set ? (scratch[k / 8] | (1 << (k & 7))) : (scratch[k / 8] & ~(1 << (k & 7)));
+    }
+  }
+  for (int16_t j = y1; j < y2; j++) {
+    for (int16_t i = x1; i < x2; i++) {
+      int16_t si = i - dx, sj = j - dy;
+      uint16_t c = color;
+      if ((si >= x1) && (si < x2) && (sj >= y1) && (sj < y2)) {
+        int32_t k = (int32_t)(sj - y1) * (x2 - x1) + (si - x1);
+        c = ((scratch[k / 8] >> (k & 7)) & 1) ? SSD1306_WHITE : SSD1306_BLACK;
+      }
+      display.drawPixel(i, j, c);
+    }
+  }
+}
+
+// copyRect() and scrollRegion() against a per-pixel copy
+static void checkCopyRect(GoldenPair &pair, uint8_t rotation, uint8_t *scratch,
+                          ssd1306_emu_writer_t writer, void *context) {
+  for (uint8_t i = 0; i < GOLDEN_RECTS; i++) {
+    for (uint8_t m = 0; m < GOLDEN_MOVES; m++) {
+      int16_t r[4];
+      pair.start(rotation, 200 + i * GOLDEN_MOVES + m);
+      goldenRect(i, pair.display.width(), pair.display.height(), r);
+      pair.display.copyRect(r[0], r[1], r[2], r[3], r[0] + golden_moves[m][0],
+                            r[1] + golden_moves[m][1]);
+      goldenCopyRect(pair.reference, scratch, r[0], r[1], r[2], r[3], r[0] + golden_moves[m][0],
+                     r[1] + golden_moves[m][1]);
+      pair.finish(writer, context, "copyrect");
+    }
+  }
+}
+
+static void checkScrollRegion(GoldenPair &pair, uint8_t rotation, uint8_t *scratch,
+                              ssd1306_emu_writer_t writer, void *context) {
+  for (uint8_t i = 0; i < GOLDEN_RECTS; i++) {
+    for (uint8_t m = 0; m < GOLDEN_MOVES; m++) {
+      uint16_t color = (m & 1) ? SSD1306_WHITE : SSD1306_BLACK;
+      int16_t r[4];
+      pair.start(rotation, 300 + i * GOLDEN_MOVES + m);
+      goldenRect(i, pair.display.width(), pair.display.height(), r);
+      pair.display.scrollRegion(r[0], r[1], r[2], r[3], golden_moves[m][0], golden_moves[m][1],
+                                color);
+      goldenScrollRegion(pair.reference, scratch, r[0], r[1], r[2], r[3], golden_moves[m][0],
+                         golden_moves[m][1], color);
+      pair.finish(writer, context, "scrollregion");
+    }
+  }
+}
+
+// invertRect() and xorBitmap() against drawPixel() with INVERSE, and
+// drawn twice against the untouched reference
+static void checkInvert(GoldenPair &pair, uint8_t rotation, uint8_t *bitmap,
+                        ssd1306_emu_writer_t writer, void *context) {
+  for (uint8_t i = 0; i < GOLDEN_RECTS; i++) {
+    for (uint8_t c = 0; c < 4; c++) {
+      int16_t r[4];
+      pair.start(rotation, 400 + i * 4 + c);
+      goldenRect(i, pair.display.width(), pair.display.height(), r);
+      goldenBitmap(bitmap, r[2] * ((r[3] + 7) / 8), pair.step);
+      switch (c) {
+      case 0:
+        pair.display.invertRect(r[0], r[1], r[2], r[3]);
+        for (int16_t y = r[1]; y < r[1] + r[3]; y++) {
+          for (int16_t x = r[0]; x < r[0] + r[2]; x++) {
+            pair.reference.drawPixel(x, y, SSD1306_INVERSE);
+          }
+        }
+        break;
+      case 1:
+        pair.display.invertRect(r[0], r[1], r[2], r[3]);
+        pair.display.invertRect(r[0], r[1], r[2], r[3]);
+        break;
+      case 2:
+        pair.display.xorBitmap(r[0], r[1], bitmap, r[2], r[3]);
+        goldenPageBitmap(pair.reference, r[0], r[1], bitmap, r[2], r[3], SSD1306_INVERSE,
+                         SSD1306_INVERSE, false);
+        break;
+      case 3:
+        pair.display.xorBitmap(r[0], r[1], bitmap, r[2], r[3]);
+        pair.display.xorBitmap(r[0], r[1], bitmap, r[2], r[3]);
+        break;
+      }
+      pair.finish(writer, context, "invert");
+    }
+  }
+}
+
+// Runs the reference checks and writes their results, returns false if
+// one failed or a display could not be started
+// getPageTextWidth() and the cursor drawPageText() returns against widths
+// added up from golden_font.h: advances of 16, 5 for '.' and 0 for the
+// blank '/', the pairs of golden_kern.txt, nothing for a missing 'x'
+static bool checkPageTextWidth(ssd1306_emu_writer_t writer, void *context) {
+  static const struct {
+    const char *text;
+    int16_t width; // Widest line
+    int16_t end;   // Cursor after the last line
+  } cases[] = {
+    { "-1.17", 63, 63 }, { "11\n7.1", 32, 32 }, { "7.x-1/1", 62, 62 }, { "7.\n11", 26, 26 },
+  };
+  Adafruit_SSD1306 display(128, 64, I2C_NUM_0);
+  Adafruit_SSD1306_Emulator emulator(128, 64);
+  bool ok = true;
+  char line[64];
+  int n;
+
+  display.setTransport(Adafruit_SSD1306_Emulator::transport, &emulator);
+  if (!display.begin(0x3C)) {
+    return false;
+  }
+  for (uint8_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    int16_t width = display.getPageTextWidth(&golden_font, cases[i].text);
+    int16_t end = display.drawPageText(3, 0, &golden_font, cases[i].text, SSD1306_WHITE) - 3;
+    if ((width != cases[i].width) || (end != cases[i].end)) {
+      n = snprintf(line, sizeof(line), "# check pagetext width #%u: FAILED, %d and %d\n", i,
+                   width, end);
+      writer(context, (const uint8_t *)line, n);
+      ok = false;
+    }
+  }
+  if (ok) {
+    n = snprintf(line, sizeof(line), "# check pagetext width: ok\n");
+    writer(context, (const uint8_t *)line, n);
+  }
+  return ok;
+}
+
+static bool runChecks(ssd1306_emu_writer_t writer, void *context) {
+  uint8_t *bitmap = (uint8_t *)malloc(GOLDEN_BITMAP_BYTES);
+  bool ok = (bitmap != NULL) && checkPageTextWidth(writer, context);
+
+  for (uint8_t g = 0; ok && (g < sizeof(golden_geometries) / sizeof(golden_geometries[0])); g++) {
+    uint8_t w = golden_geometries[g][0], h = golden_geometries[g][1];
+    GoldenPair pair(w, h);
+    if (!pair.begin()) {
+      ok = false;
+      break;
+    }
+
+    for (uint8_t r = 0; r < 4; r++) {
+      checkGfx(pair, w, h, r, writer, context);
+      ok &= pair.report(writer, context, "gfx");
+      checkRowMajorBitmap(pair, r, bitmap, writer, context);
+      ok &= pair.report(writer, context, "rowmajor");
+      checkPageBitmap(pair, r, bitmap, writer, context);
+      ok &= pair.report(writer, context, "pagebitmap");
+      checkCopyRect(pair, r, bitmap, writer, context);
+      ok &= pair.report(writer, context, "copyrect");
+      checkScrollRegion(pair, r, bitmap, writer, context);
+      ok &= pair.report(writer, context, "scrollregion");
+      checkInvert(pair, r, bitmap, writer, context);
+      ok &= pair.report(writer, context, "invert");
+    }
+  }
+  free(bitmap);
+  return ok;
+}
+
+#endif // _GOLDEN_SCENE_H_
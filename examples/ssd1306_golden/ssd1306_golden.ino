@@ -0,0 +1,43 @@
+/**************************************************************************
+ Golden-image dump for regression checks of the SSD1306 library.
+
+ Renders the test scene of golden_scene.h for every supported geometry
+ (128x64, 128x32, 96x16) and rotation through an Adafruit_SSD1306_Emulator,
+ and prints what the emulated panel shows as plain PBM images on the
+ serial console. The images come from the command/data stream the library
+ sends, so address windows and partial updates are checked too, not only
+ the buffer. The reference checks of runChecks() follow as "# check"
+ lines, which pbm_compare.py skips.
+
+ The same scene is rendered on the host by test/ (make -C test), which
+ compares it against the golden images in test/golden without hardware.
+ The images do not depend on the Adafruit GFX version, so a board capture
+ can be compared with test/golden directly, or against its own images
+ captured once from a known good version:
+   scripts/pbm_compare.py --update capture.txt golden-board/
+ and compare every later version against it:
+   scripts/pbm_compare.py capture.txt golden-board/
+
+ BSD license, check license.txt for more information
+ **************************************************************************/
+
+#include "golden_scene.h"
+
+void serialWriter(void *context, const uint8_t *data, size_t len) {
+  Serial.write(data, len);
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!renderGoldens(serialWriter, NULL)) {
+    Serial.println(F("SSD1306 allocation failed"));
+    for (;;); // Don't proceed, loop forever
+  }
+  if (!runChecks(serialWriter, NULL)) {
+    Serial.println(F("Reference checks failed"));
+  }
+}
+
+void loop() {
+}
@@ -0,0 +1,52 @@
+// Generated by make_font.py, 414 bytes of glyph bitmaps
+
+#include <Adafruit_SSD1306_Font.h>
+
+const uint8_t PROGMEM segment24_bitmap[] = {
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x1C,0x1C,0x1C,0x1C,0x1C,
+  0x1C,0x1C,0x1C,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x70,0x70,0x70,0xF8,0xFC,0xFA,0x07,0x07,0x07,0x07,0x07,0x07,
+  0x07,0x07,0xFA,0xFC,0xF8,0xE3,0xF7,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xE3,0xF7,0xE3,0x0F,0x1F,0x2F,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x2F,0x1F,
+  0x0F,0xF8,0xFC,0xF8,0xE3,0xF7,0xE3,0x0F,0x1F,0x0F,0x00,0x00,0x02,0x07,0x07,0x07,
+  0x07,0x07,0x07,0x07,0x07,0xFA,0xFC,0xF8,0xE0,0xF0,0xE8,0x1C,0x1C,0x1C,0x1C,0x1C,
+  0x1C,0x1C,0x1C,0x0B,0x07,0x03,0x0F,0x1F,0x2F,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
+  0x70,0x20,0x00,0x00,0x02,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xFA,0xFC,0xF8,
+  0x08,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xEB,0xF7,0xE3,0x20,0x70,0x70,0x70,
+  0x70,0x70,0x70,0x70,0x70,0x2F,0x1F,0x0F,0xF8,0xFC,0xF8,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xF8,0xFC,0xF8,0x03,0x07,0x0B,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,
+  0x1C,0xEB,0xF7,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,
+  0x1F,0x0F,0xF8,0xFC,0xFA,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x02,0x00,0x00,
+  0x03,0x07,0x0B,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xE8,0xF0,0xE0,0x00,0x00,
+  0x20,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x2F,0x1F,0x0F,0xF8,0xFC,0xFA,0x07,
+  0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x02,0x00,0x00,0xE3,0xF7,0xEB,0x1C,0x1C,0x1C,
+  0x1C,0x1C,0x1C,0x1C,0x1C,0xE8,0xF0,0xE0,0x0F,0x1F,0x2F,0x70,0x70,0x70,0x70,0x70,
+  0x70,0x70,0x70,0x2F,0x1F,0x0F,0x02,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xFA,
+  0xFC,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0xF7,0xE3,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x1F,0x0F,0xF8,0xFC,0xFA,0x07,0x07,0x07,
+  0x07,0x07,0x07,0x07,0x07,0xFA,0xFC,0xF8,0xE3,0xF7,0xEB,0x1C,0x1C,0x1C,0x1C,0x1C,
+  0x1C,0x1C,0x1C,0xEB,0xF7,0xE3,0x0F,0x1F,0x2F,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
+  0x70,0x2F,0x1F,0x0F,0xF8,0xFC,0xFA,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xFA,
+  0xFC,0xF8,0x03,0x07,0x0B,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xEB,0xF7,0xE3,
+  0x00,0x00,0x20,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x2F,0x1F,0x0F,
+};
+
+const ssd1306_font_glyph_t PROGMEM segment24_glyphs[] = {
+  {    0,  10,  16,   3}, // 0x2D -
+  {   30,   3,   5,   1}, // 0x2E .
+  {    0,   0,   0,   0}, // 0x2F /
+  {   39,  14,  16,   1}, // 0x30 0
+  {   81,   3,  16,  12}, // 0x31 1
+  {   90,  14,  16,   1}, // 0x32 2
+  {  132,  12,  16,   3}, // 0x33 3
+  {  168,  14,  16,   1}, // 0x34 4
+  {  210,  14,  16,   1}, // 0x35 5
+  {  252,  14,  16,   1}, // 0x36 6
+  {  294,  12,  16,   3}, // 0x37 7
+  {  330,  14,  16,   1}, // 0x38 8
+  {  372,  14,  16,   1}, // 0x39 9
+};
+
+const ssd1306_font_t PROGMEM segment24 = {
+  segment24_bitmap, segment24_glyphs, NULL, 0,
+  0x2D, 0x39, 24, 24, 24};
@@ -0,0 +1,70 @@
+/**************************************************************************
+ Large digit readout with Adafruit_SSD1306_Number.
+
+ Counts a fixed-point value with one decimal from -99.9 up in 24 pixel
+ seven-segment digits. Each update() redraws only the digit cells whose
+ character changed and sends just those columns, so the last digit costs
+ a few dozen bytes on the bus instead of a full frame.
+
+ The font in segment24.h was generated from segment24.bdf with
+   scripts/make_font.py segment24.bdf segment24 > segment24.h
+ and any other Adafruit_GFX or BDF digit font converts the same way.
+
+ Set OLED_SDA and OLED_SCL to the I2C pins of the board.
+
+ BSD license, check license.txt for more information
+ **************************************************************************/
+
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+#include <Adafruit_SSD1306_Number.h>
+#include "segment24.h"
+
+#define SCREEN_WIDTH 128 // OLED display width, in pixels
+#define SCREEN_HEIGHT 64 // OLED display height, in pixels
+#define SCREEN_ADDRESS 0x3C
+
+#define OLED_SDA 21
+#define OLED_SCL 22
+
+Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, I2C_NUM_0);
+
+// Four digit cells, one of them for the sign, and one decimal: -99.9 to
+// 999.9. The cells are 16 pixels wide and the point 5, 69 in total, so
+// column 29 centers the readout; row 24 puts it on three whole pages.
+#define NUMBER_X 29
+#define NUMBER_Y 24
+Adafruit_SSD1306_Number number(&display, &segment24, NUMBER_X, NUMBER_Y, 4, 1);
+
+int32_t value = -999; // Tenths
+
+void setup() {
+  Serial.begin(115200);
+
+  i2c_config_t conf = {};
+  conf.mode = I2C_MODE_MASTER;
+  conf.sda_io_num = OLED_SDA;
+  conf.scl_io_num = OLED_SCL;
+  conf.sda_pullup_en = GPIO_PULLUP_ENABLE;
+  conf.scl_pullup_en = GPIO_PULLUP_ENABLE;
+  conf.master.clk_speed = 400000;
+  i2c_param_config(I2C_NUM_0, &conf);
+  i2c_driver_install(I2C_NUM_0, conf.mode, 0, 0, 0);
+
+  if (!display.begin(SCREEN_ADDRESS)) {
+    Serial.println(F("SSD1306 allocation failed"));
+    for (;;); // Don't proceed, loop forever
+  }
+  display.clearDisplay();
+  display.display();
+}
+
+void loop() {
+  number.setValue(value);
+  number.update();
+
+  if (++value > 9999) {
+    value = -999;
+  }
+  delay(50);
+}
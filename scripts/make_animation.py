@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+# pip install pillow to get the PIL module
+#
+# Converts an animated GIF, or a list of images, into the animation format
+# played by Adafruit_SSD1306_Animation:
+#
+#   width, height, frame count (16 bits, little-endian), then per frame
+#   either a keyframe:  0xFE, length (16 bits, little-endian), length bytes
+#                       of make_splash.py --rle output
+#   or a delta:         spans of page, x, len, len bytes to XOR into the
+#                       previous frame, ended by 0xFF
+#
+# The first frame is always a keyframe. A later frame becomes one when its
+# delta would be larger, or every --keyframe frames if given.
+
+import sys
+from PIL import Image, ImageSequence
+from make_splash import page_bytes, rle_tokens, print_bytes
+
+SPAN_GAP = 3 # merge spans this close, a span header costs 3 bytes
+
+def delta(prev, cur, width, pages):
+  out = []
+  for p in range(0, pages):
+    row = [prev[p*width + x] ^ cur[p*width + x] for x in range(0, width)]
+    x = 0
+    while x < width:
+      if not row[x]:
+        x += 1
+        continue
+      end = x + 1
+      gap = 0
+      while end + gap < width and end - x + gap < 255:
+        if row[end + gap]:
+          end += gap + 1
+          gap = 0
+        elif gap < SPAN_GAP:
+          gap += 1
+        else:
+          break
+      out += [p, x, end - x] + row[x:end]
+      x = end
+  return out + [0xFF]
+
+def keyframe(data, width, height):
+  blob = [width, height] + rle_tokens(data)
+  return [0xFE, len(blob) & 0xFF, len(blob) >> 8] + blob
+
+def main(files, id, interval):
+  frames = []
+  for fn in files:
+    for frame in ImageSequence.Iterator(Image.open(fn)):
+      frames.append(frame.convert('1'))
+  width = frames[0].width
+  height = frames[0].height
+  if width > 255 or height > 255:
+    print("{}: image larger than 255x255".format(id), file=sys.stderr)
+    sys.exit(1)
+  if len(frames) > 0xFFFF or any(f.size != frames[0].size for f in frames):
+    print("{}: frames differ in size or are too many".format(id), file=sys.stderr)
+    sys.exit(1)
+
+  out = [width, height, len(frames) & 0xFF, len(frames) >> 8]
+  prev = None
+  for n, frame in enumerate(frames):
+    data = page_bytes(frame)
+    key = keyframe(data, width, height)
+    if prev is None or (interval and n % interval == 0):
+      out += key
+    else:
+      d = delta(prev, data, width, (height + 7)//8)
+      out += d if len(d) <= len(key) else key
+    prev = data
+
+  print("\n"
+        "#define {id}_width  {w}\n"
+        "#define {id}_height {h}\n"
+        "#define {id}_frames {f}\n"
+        "\n"
+        "// {n} bytes, {p} as page format frames\n"
+        "const uint8_t PROGMEM {id}_anim[] = {{\n"
+        .format(id=id, w=width, h=height, f=len(frames), n=len(out),
+                p=len(frames) * width * ((height + 7)//8)), end='')
+  print_bytes(out)
+  print("};")
+
+if __name__ == '__main__':
+    args = sys.argv[1:]
+    interval = 0
+    if len(args) >= 2 and args[0] == '--keyframe':
+      interval = int(args[1])
+      args = args[2:]
+    if len(args) < 2:
+      print("Usage: {} [--keyframe N] <imagefile>... <id>\n".format(sys.argv[0]), file=sys.stderr);
+      sys.exit(1)
+    main(args[:-1], args[-1], interval)
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+#
+# Converts an Adafruit_GFX font header (Fonts/*.h) or a BDF font into the
+# page format font drawn by Adafruit_SSD1306::drawPageText(), see
+# Adafruit_SSD1306_Font.h.
+#
+# Glyphs are trimmed to their ink columns and stored as page format
+# bitmaps covering the full font height. Kerning pairs can be added from a
+# text file with one "<left> <right> <pixels>" line per pair, characters
+# given literally or as numbers (e.g. "A V -1" or "0x54 0x6F -1").
+
+import re
+import sys
+
+def c_int(s):
+  return int(s, 0)
+
+# Glyphs as {code: (advance, xOffset, yOffset, rows)}: rows is a list of
+# bitmap rows, each a list of 0/1, yOffset is the top row relative to the
+# baseline (negative above it), like GFXglyph.
+def read_gfx(text):
+  text = re.sub(r'//[^\n]*|/\*.*?\*/', '', text, flags=re.S)
+  m = re.search(r'\w+\s+\w+Bitmaps\s*\[\s*\]\s*\w*\s*=\s*\{(.*?)\}', text, re.S)
+  bitmap = [c_int(v) for v in m.group(1).replace(',', ' ').split()]
+  m = re.search(r'GFXglyph\s+\w+Glyphs\s*\[\s*\]\s*\w*\s*=\s*\{(.*)\}\s*;', text, re.S)
+  entries = re.findall(r'\{([^{}]*)\}', m.group(1))
+  m = re.search(r'GFXfont\s+\w+\s*\w*\s*=\s*\{(.*?)\}\s*;', text, re.S)
+  fields = [f.strip() for f in m.group(1).split(',')]
+  first = c_int(fields[2])
+  yAdvance = c_int(fields[4])
+
+  glyphs = {}
+  for i, entry in enumerate(entries):
+    offset, w, h, adv, xo, yo = [c_int(v) for v in entry.split(',')]
+    bits = []
+    for b in bitmap[offset:offset + (w*h + 7)//8]:
+      bits += [(b >> (7 - k)) & 1 for k in range(0, 8)]
+    rows = [bits[y*w:(y + 1)*w] for y in range(0, h)]
+    glyphs[first + i] = (adv, xo, yo, rows)
+  return glyphs, yAdvance
+
+def read_bdf(text):
+  glyphs = {}
+  yAdvance = None
+  lines = iter(text.splitlines())
+  for line in lines:
+    words = line.split()
+    if not words:
+      continue
+    if words[0] == 'FONTBOUNDINGBOX':
+      yAdvance = int(words[2])
+    elif words[0] == 'STARTCHAR':
+      code = adv = None
+      w = h = xo = yo = 0
+      rows = []
+      for line in lines:
+        words = line.split()
+        if words[0] == 'ENCODING':
+          code = int(words[1])
+        elif words[0] == 'DWIDTH':
+          adv = int(words[1])
+        elif words[0] == 'BBX':
+          w, h, xo, yo = [int(v) for v in words[1:5]]
+        elif words[0] == 'BITMAP':
+          for y in range(0, h):
+            # Rows are hex, padded to whole bytes
+            digits = next(lines).strip()
+            v = int(digits, 16)
+            rows.append([(v >> (len(digits)*4 - 1 - x)) & 1 for x in range(0, w)])
+        elif words[0] == 'ENDCHAR':
+          break
+      if code is not None and 0 <= code <= 255:
+        # BDF offsets are to the bottom row, upwards
+        glyphs[code] = (adv if adv is not None else w, xo, -(yo + h), rows)
+  return glyphs, yAdvance
+
+def read_kerning(fn):
+  pairs = []
+  for line in open(fn):
+    words = line.split()
+    if len(words) != 3 or words[0].startswith('#'):
+      continue
+    left, right = [ord(w) if len(w) == 1 else c_int(w) for w in words[:2]]
+    pairs.append((left, right, int(words[2])))
+  return sorted(pairs)
+
+def convert(glyphs, yAdvance, kerning, id):
+  codes = sorted(glyphs)
+  first, last = codes[0], codes[-1]
+  ascent = max([-g[2] for g in glyphs.values() if g[3]] + [0])
+  descent = max([g[2] + len(g[3]) for g in glyphs.values() if g[3]] + [0])
+  height = ascent + descent
+  pages = (height + 7)//8
+  if yAdvance is None:
+    yAdvance = height
+
+  bitmap = []
+  table = []
+  for code in range(first, last + 1):
+    adv, xo, yo, rows = glyphs.get(code, (0, 0, 0, []))
+    w = len(rows[0]) if rows else 0
+    ink = [x for x in range(0, w) if any(r[x] for r in rows)]
+    if not ink:
+      table.append((0, 0, adv, 0, code))
+      continue
+    x1, x2 = ink[0], ink[-1]
+    offset = len(bitmap)
+    for p in range(0, pages):
+      for x in range(x1, x2 + 1):
+        byte = 0
+        for r in range(0, 8):
+          y = p*8 + r - ascent - yo # row within the glyph bitmap
+          if 0 <= y < len(rows) and rows[y][x]:
+            byte |= 1 << r
+        bitmap.append(byte)
+    table.append((offset, x2 - x1 + 1, adv, xo + x1, code))
+
+  if len(bitmap) > 0xFFFF or height > 255:
+    print("{}: font too large".format(id), file=sys.stderr)
+    sys.exit(1)
+
+  print("// Generated by make_font.py, {} bytes of glyph bitmaps\n"
+        "\n"
+        "#include <Adafruit_SSD1306_Font.h>\n"
+        "\n"
+        "const uint8_t PROGMEM {}_bitmap[] = {{".format(len(bitmap), id))
+  for i in range(0, len(bitmap)):
+    if i % 16 == 0:
+      print("  ", end='')
+    print("0x{:02X},".format(bitmap[i]), end='')
+    if i % 16 == 15 or i == len(bitmap) - 1:
+      print()
+  print("}};\n\nconst ssd1306_font_glyph_t PROGMEM {}_glyphs[] = {{".format(id))
+  for offset, w, adv, xo, code in table:
+    name = chr(code) if 32 < code < 127 and chr(code) not in "\\'" else ''
+    print("  {{{:5d}, {:3d}, {:3d}, {:3d}}}, // 0x{:02X} {}".format(offset, w, adv, xo, code, name).rstrip())
+  print("};\n")
+  if kerning:
+    print("const ssd1306_font_kern_t PROGMEM {}_kerning[] = {{".format(id))
+    for left, right, adjust in kerning:
+      print("  {{0x{:02X}, 0x{:02X}, {}}},".format(left, right, adjust))
+    print("};\n")
+  print("const ssd1306_font_t PROGMEM {id} = {{\n"
+        "  {id}_bitmap, {id}_glyphs, {kern}, {n},\n"
+        "  0x{first:02X}, 0x{last:02X}, {height}, {ascent}, {yAdvance}}};"
+        .format(id=id, kern=id + '_kerning' if kerning else 'NULL', n=len(kerning),
+                first=first, last=last, height=height, ascent=ascent, yAdvance=yAdvance))
+
+if __name__ == '__main__':
+    args = sys.argv[1:]
+    kerning = []
+    if len(args) >= 2 and args[0] == '--kern':
+      kerning = read_kerning(args[1])
+      args = args[2:]
+    if len(args) < 2:
+      print("Usage: {} [--kern <pairs.txt>] <font.h | font.bdf> <id>\n".format(sys.argv[0]), file=sys.stderr);
+      sys.exit(1)
+    text = open(args[0]).read()
+    if args[0].lower().endswith('.bdf'):
+      glyphs, yAdvance = read_bdf(text)
+    else:
+      glyphs, yAdvance = read_gfx(text)
+    convert(glyphs, yAdvance, kerning, args[1])
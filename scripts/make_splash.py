@@ -4,8 +4,10 @@
 import sys
 from PIL import Image
 
-def main(fn, id):
-  image = Image.open(fn)
+def pixel(image, x, y):
+  return x < image.width and y < image.height and image.getpixel((x,y)) != 0
+
+def rows(image, id):
   print("\n"
         "#define {id}_width  {w}\n"
         "#define {id}_height {h}\n"
@@ -20,7 +22,7 @@ def main(fn, id):
         print("0b", end='')
 
       bit = '0'
-      if x < image.width and image.getpixel((x,y)) != 0:
+      if pixel(image, x, y):
         bit = '1'
       print(bit, end='')
 
@@ -29,10 +31,100 @@ def main(fn, id):
     print()
   print("};")
 
+# SSD1306 page format, as drawn by drawPageBitmap(): (height + 7) / 8 pages
+# of width bytes, one byte per column of 8 pixels, least significant bit on top
+def page_bytes(image):
+  data = []
+  for p in range(0, (image.height + 7)//8):
+    for x in range(0, image.width):
+      byte = 0
+      for r in range(0, 8):
+        if pixel(image, x, p*8 + r):
+          byte |= 1 << r
+      data.append(byte)
+  return data
+
+def pages(image, id):
+  data = page_bytes(image)
+  print("\n"
+        "#define {id}_width  {w}\n"
+        "#define {id}_height {h}\n"
+        "\n"
+        "const uint8_t PROGMEM {id}_pages[] = {{\n"
+        .format(id=id, w=image.width, h=image.height), end='')
+  for i in range(0, len(data)):
+    x = i % image.width
+    if x % 16 == 0:
+      print("  ", end='')
+    print("0x{:02X},".format(data[i]), end='')
+    if x % 16 == 15 or x == image.width - 1:
+      print()
+  print("};")
+
+def print_bytes(data):
+  for i in range(0, len(data)):
+    if i % 16 == 0:
+      print("  ", end='')
+    print("0x{:02X},".format(data[i]), end='')
+    if i % 16 == 15 or i == len(data) - 1:
+      print()
+
+def rle_tokens(data):
+  out = []
+  i = 0
+  while i < len(data):
+    run = 1
+    while i + run < len(data) and run < 129 and data[i + run] == data[i]:
+      run += 1
+    if run >= 2:
+      out += [0x7E + run, data[i]]
+      i += run
+      continue
+    # Literals up to the next run of 3 or more
+    j = i
+    while j < len(data) and j - i < 128:
+      if j + 2 < len(data) and data[j] == data[j + 1] == data[j + 2]:
+        break
+      j += 1
+    out += [j - i - 1] + data[i:j]
+    i = j
+  return out
+
+# Run-length encoded page format, as drawn by drawRLEBitmap(): width and
+# height bytes, then the page bytes as tokens. A token byte t < 0x80 is
+# followed by t + 1 literal bytes, t >= 0x80 by one byte repeated t - 0x7E
+# times (2 to 129).
+def rle(image, id):
+  if image.width > 255 or image.height > 255:
+    print("{}: image larger than 255x255".format(id), file=sys.stderr)
+    sys.exit(1)
+  data = page_bytes(image)
+  out = [image.width, image.height] + rle_tokens(data)
+  print("\n"
+        "#define {id}_width  {w}\n"
+        "#define {id}_height {h}\n"
+        "\n"
+        "// {n} bytes, {p} uncompressed\n"
+        "const uint8_t PROGMEM {id}_rle[] = {{\n"
+        .format(id=id, w=image.width, h=image.height, n=len(out), p=len(data)), end='')
+  print_bytes(out)
+  print("};")
+
+def main(fn, id, mode):
+  image = Image.open(fn)
+  if mode == '--pages':
+    pages(image, id)
+  elif mode == '--rle':
+    rle(image, id)
+  else:
+    rows(image, id)
+
 if __name__ == '__main__':
-    if len(sys.argv) < 3:
-      print("Usage: {} <imagefile> <id>\n".format(sys.argv[0]), file=sys.stderr);
+    modes = [a for a in sys.argv[1:] if a in ('--pages', '--rle')]
+    args = [a for a in sys.argv[1:] if a not in modes]
+    if len(args) < 2 or len(modes) > 1:
+      print("Usage: {} [--pages | --rle] <imagefile> <id>\n".format(sys.argv[0]), file=sys.stderr);
       sys.exit(1)
-    fn = sys.argv[1]
-    id = sys.argv[2]
-    main(fn, id)
+    fn = args[0]
+    id = args[1]
+    main(fn, id, modes[0] if modes else None)
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+# Compare the PBM images in a capture (e.g. the serial output of the
+# ssd1306_golden example) against golden images, one <name>.pbm per image.
+
+import os
+import sys
+
+def tokens(text):
+  for line in text.splitlines():
+    line = line.split('#', 1)[0]
+    for tok in line.split():
+      yield tok
+
+def parse_capture(fn):
+  """Return a list of (name, width, height, pixels) for each plain PBM."""
+  images = []
+  with open(fn, 'r', errors='replace') as f:
+    lines = [l.strip() for l in f]
+  i = 0
+  while i < len(lines):
+    if lines[i] != 'P1':
+      i += 1
+      continue
+    i += 1
+    name = 'image{}'.format(len(images))
+    if i < len(lines) and lines[i].startswith('#'):
+      name = lines[i][1:].strip()
+      i += 1
+    w, h = (int(v) for v in lines[i].split())
+    i += 1
+    rows = lines[i:i + h]
+    i += h
+    pixels = ''.join(rows).replace(' ', '')
+    images.append((name, w, h, pixels))
+  return images
+
+def read_pbm(fn):
+  """Read a plain (P1) or packed (P4) PBM, return (width, height, pixels)."""
+  with open(fn, 'rb') as f:
+    data = f.read()
+  if data.startswith(b'P1'):
+    tok = list(tokens(data.decode('ascii')))
+    w, h = int(tok[1]), int(tok[2])
+    return w, h, ''.join(tok[3:])[:w * h]
+  # P4: header is magic, width, height, then a single whitespace
+  fields, pos = [], 2
+  while len(fields) < 2:
+    while data[pos:pos + 1].isspace():
+      pos += 1
+    if data[pos:pos + 1] == b'#':
+      pos = data.index(b'\n', pos)
+      continue
+    start = pos
+    while not data[pos:pos + 1].isspace():
+      pos += 1
+    fields.append(int(data[start:pos]))
+  w, h = fields
+  pos += 1
+  stride = (w + 7) // 8
+  pixels = []
+  for y in range(h):
+    row = data[pos + y * stride:pos + (y + 1) * stride]
+    for x in range(w):
+      pixels.append('1' if row[x // 8] & (0x80 >> (x & 7)) else '0')
+  return w, h, ''.join(pixels)
+
+def write_pbm(fn, name, w, h, pixels):
+  with open(fn, 'w') as f:
+    f.write('P1\n# {}\n{} {}\n'.format(name, w, h))
+    for y in range(h):
+      f.write(pixels[y * w:(y + 1) * w] + '\n')
+
+def main(capture, golden, update):
+  images = parse_capture(capture)
+  if not images:
+    print("No PBM images found in {}".format(capture), file=sys.stderr)
+    return 1
+  failed = 0
+  for name, w, h, pixels in images:
+    fn = os.path.join(golden, name + '.pbm')
+    if update:
+      os.makedirs(golden, exist_ok=True)
+      write_pbm(fn, name, w, h, pixels)
+      print("wrote {}".format(fn))
+      continue
+    if not os.path.exists(fn):
+      print("MISSING {}".format(fn))
+      failed += 1
+      continue
+    gw, gh, gpixels = read_pbm(fn)
+    if (gw, gh) != (w, h):
+      print("FAIL {}: size {}x{}, golden {}x{}".format(name, w, h, gw, gh))
+      failed += 1
+      continue
+    diff = [i for i in range(w * h) if pixels[i] != gpixels[i]]
+    if diff:
+      x, y = diff[0] % w, diff[0] // w
+      print("FAIL {}: {} pixels differ, first at ({}, {})".format(name, len(diff), x, y))
+      failed += 1
+    else:
+      print("ok   {}".format(name))
+  if not update:
+    print("{} of {} images differ".format(failed, len(images)))
+  return 1 if failed else 0
+
+if __name__ == '__main__':
+  args = [a for a in sys.argv[1:] if a != '--update']
+  if len(args) != 2:
+    print("Usage: {} [--update] <capture> <golden dir>\n".format(sys.argv[0]), file=sys.stderr)
+    sys.exit(1)
+  sys.exit(main(args[0], args[1], '--update' in sys.argv[1:]))
@@ -0,0 +1,15 @@
+// Host build of the ssd1306_benchmark measurements, see
+// examples/ssd1306_benchmark/benchmark.h. Run through the Makefile in this
+// directory: make bench.
+
+#define BENCH_PRINTF printf
+#include "benchmark.h"
+
+int main(void)
+{
+    if (!runBenchmarks()) {
+        fprintf(stderr, "SSD1306 allocation failed\n");
+        return 1;
+    }
+    return 0;
+}
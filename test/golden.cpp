@@ -0,0 +1,24 @@
+// Host renderer of the golden-image check: writes the PBM images of
+// examples/ssd1306_golden/golden_scene.h to stdout, for
+// scripts/pbm_compare.py, and the results of its reference checks to
+// stderr. Run through the Makefile in this directory.
+
+#include "golden_scene.h"
+
+static void fileWriter(void *context, const uint8_t *data, size_t len)
+{
+    fwrite(data, 1, len, (FILE *)context);
+}
+
+int main(void)
+{
+    if (!renderGoldens(fileWriter, stdout)) {
+        fprintf(stderr, "SSD1306 allocation failed\n");
+        return 1;
+    }
+    if (!runChecks(fileWriter, stderr)) {
+        fprintf(stderr, "reference checks failed\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+# pip install pillow to get the PIL module
+#
+# Writes the frames of the test animation played by rle.cpp as PNG files
+# into <dir>, and prints the same frames in the page format of
+# make_splash.py --pages as the reference, frame after frame.
+#
+# The frames are 40x20, so the last page is partial: a square moving
+# across a fixed pattern, one frame repeated (an empty delta), and the
+# whole image inverted halfway (a delta larger than the keyframe).
+
+import os
+import sys
+from PIL import Image, ImageDraw
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..', 'scripts'))
+from make_splash import page_bytes, print_bytes
+
+WIDTH = 40
+HEIGHT = 20
+FRAMES = 24
+
+def frame(n):
+  image = Image.new('1', (WIDTH, HEIGHT), 0)
+  draw = ImageDraw.Draw(image)
+  draw.rectangle((0, 0, WIDTH - 1, HEIGHT - 1), outline=1)
+  draw.line((0, HEIGHT - 1, WIDTH - 1, 0), fill=1)
+  if n == 9:
+    n = 8 # Repeats the previous frame
+  x = (n * 3) % (WIDTH - 6)
+  y = (n * 5) % (HEIGHT - 6)
+  draw.rectangle((x, y, x + 5, y + 5), fill=1)
+  if n >= 12:
+    image = image.convert('L').point(lambda v: 255 - v).convert('1')
+  return image
+
+def main(dir):
+  data = []
+  for n in range(0, FRAMES):
+    image = frame(n)
+    image.save(os.path.join(dir, "frame{:02d}.png".format(n)))
+    data += page_bytes(image)
+  print("\n"
+        "#define frames_width  {w}\n"
+        "#define frames_height {h}\n"
+        "#define frames_count  {n}\n"
+        "\n"
+        "const uint8_t PROGMEM frames_pages[] = {{\n"
+        .format(w=WIDTH, h=HEIGHT, n=FRAMES), end='')
+  print_bytes(data)
+  print("};")
+
+if __name__ == '__main__':
+  if len(sys.argv) != 2:
+    print("Usage: {} <dir>\n".format(sys.argv[0]), file=sys.stderr);
+    sys.exit(1)
+  main(sys.argv[1])
@@ -0,0 +1,205 @@
+// Host test of drawRLEBitmap() and Adafruit_SSD1306_Animation: runs and
+// literals of every length class compared with drawPageBitmap() of the
+// decoded bytes, the make_splash.py --rle splashes decoded byte for byte
+// against their --pages output, and make_animation.py output played
+// with step() against each frame in page format. The data comes from
+// rle_data.h, generated by the Makefile in this directory.
+
+#include "golden_check.h"
+#include <Adafruit_SSD1306_Animation.h>
+#include "rle_data.h"
+
+#define RLE_MAX (2 + 255 * 8 * 2)
+
+static int failures;
+
+static void fileWriter(void *context, const uint8_t *data, size_t len)
+{
+    fwrite(data, 1, len, (FILE *)context);
+}
+
+static void expect(bool ok, const char *what)
+{
+    fprintf(stderr, "# check rle %s: %s\n", what, ok ? "ok" : "FAILED");
+    if (!ok) {
+        failures++;
+    }
+}
+
+// A token stream built next to the page bytes it stands for
+struct Encoded {
+    uint8_t rle[RLE_MAX];
+    uint8_t pages[255 * 8];
+    size_t rleLen;
+    size_t pagesLen;
+
+    Encoded(uint8_t w, uint8_t h) : rleLen(2), pagesLen(0)
+    {
+        rle[0] = w;
+        rle[1] = h;
+    }
+
+    // count bytes of value, 2 to 129
+    void run(uint8_t count, uint8_t value)
+    {
+        rle[rleLen++] = 0x7E + count;
+        rle[rleLen++] = value;
+        memset(pages + pagesLen, value, count);
+        pagesLen += count;
+    }
+
+    // count pseudo-random bytes, 1 to 128
+    void literal(uint8_t count, uint32_t seed)
+    {
+        rle[rleLen++] = count - 1;
+        goldenBitmap(rle + rleLen, count, seed);
+        memcpy(pages + pagesLen, rle + rleLen, count);
+        rleLen += count;
+        pagesLen += count;
+    }
+};
+
+// Runs and literals of the shortest and longest lengths, crossing page
+// rows, and the widest image, clipped by any display
+static void encodeCases(Encoded **cases)
+{
+    cases[0] = new Encoded(50, 20);
+    cases[0]->run(129, 0xAA);
+    cases[0]->literal(1, 3);
+    cases[0]->run(2, 0x0F);
+    cases[0]->literal(18, 5);
+
+    cases[1] = new Encoded(50, 20);
+    cases[1]->literal(128, 7);
+    cases[1]->run(22, 0x5A);
+
+    cases[2] = new Encoded(255, 3);
+    cases[2]->run(129, 0xFF);
+    cases[2]->literal(126, 11);
+}
+
+// Each case at each placement, transparent in all colors and opaque
+static void checkDecoder(uint8_t w, uint8_t h)
+{
+    static const uint16_t colors[][2] = {
+        { SSD1306_WHITE, 0xFFFF }, { SSD1306_BLACK, 0xFFFF }, { SSD1306_INVERSE, 0xFFFF },
+        { SSD1306_WHITE, SSD1306_BLACK }, { SSD1306_BLACK, SSD1306_WHITE },
+    };
+    GoldenPair pair(w, h);
+    Encoded *cases[3];
+
+    if (!pair.begin()) {
+        expect(false, "allocation");
+        return;
+    }
+    encodeCases(cases);
+    for (uint8_t rotation = 0; rotation < 4; rotation++) {
+        for (uint8_t c = 0; c < 3; c++) {
+            for (uint8_t i = 0; i < GOLDEN_RECTS; i++) {
+                for (uint8_t k = 0; k < sizeof(colors) / sizeof(colors[0]); k++) {
+                    int16_t r[4];
+                    pair.start(rotation, 1 + c * 131 + i * 17 + k);
+                    goldenRect(i, pair.display.width(), pair.display.height(), r);
+                    if (colors[k][1] == 0xFFFF) {
+                        pair.display.drawRLEBitmap(r[0], r[1], cases[c]->rle, colors[k][0]);
+                        pair.reference.drawPageBitmap(r[0], r[1], cases[c]->pages, cases[c]->rle[0],
+                                                      cases[c]->rle[1], colors[k][0]);
+                    }
+                    else {
+                        pair.display.drawRLEBitmap(r[0], r[1], cases[c]->rle, colors[k][0],
+                                                   colors[k][1]);
+                        pair.reference.drawPageBitmap(r[0], r[1], cases[c]->pages, cases[c]->rle[0],
+                                                      cases[c]->rle[1], colors[k][0], colors[k][1]);
+                    }
+                    pair.finish(fileWriter, stderr, "rle");
+                }
+            }
+        }
+        if (!pair.report(fileWriter, stderr, "rle")) {
+            failures++;
+        }
+    }
+    for (uint8_t c = 0; c < 3; c++) {
+        delete cases[c];
+    }
+}
+
+// A splash decoded onto a cleared display holds its page format bytes
+static void checkSplash(const char *name, const uint8_t *rle, const uint8_t *pages,
+                        uint8_t w, uint8_t h)
+{
+    Adafruit_SSD1306 display(128, 64, I2C_NUM_0);
+    Adafruit_SSD1306_Emulator emulator(128, 64);
+    char what[48];
+    bool ok;
+
+    display.setTransport(Adafruit_SSD1306_Emulator::transport, &emulator);
+    if (!display.begin(0x3C)) {
+        expect(false, "allocation");
+        return;
+    }
+    display.clearDisplay();
+    display.drawRLEBitmap(0, 0, rle, SSD1306_WHITE, SSD1306_BLACK);
+    ok = (rle[0] == w) && (rle[1] == h);
+    for (uint8_t p = 0; ok && p < (h + 7) / 8; p++) {
+        ok = !memcmp(display.getBuffer() + p * 128, pages + p * w, w);
+    }
+    snprintf(what, sizeof(what), "%s equals --pages", name);
+    expect(ok, what);
+}
+
+// Every frame of an animation once without looping, then twice with
+// looping against the frame drawn opaque from its page format
+static void checkAnimation(const char *name, const uint8_t *data, int16_t x, int16_t y)
+{
+    const size_t size = frames_width * ((frames_height + 7) / 8);
+    GoldenPair pair(128, 64);
+    char what[48];
+
+    if (!pair.begin()) {
+        expect(false, "allocation");
+        return;
+    }
+    for (uint8_t rotation = 0; rotation < 4; rotation++) {
+        Adafruit_SSD1306_Animation anim(&pair.display, data, x, y);
+        bool ok = (anim.getFrames() == frames_count) && (anim.width() == frames_width) &&
+                  (anim.height() == frames_height);
+
+        pair.start(rotation, 5 + rotation);
+        pair.step = 0;
+        anim.setLoop(false);
+        for (int i = 0; ok && i < frames_count; i++) {
+            ok = anim.step();
+        }
+        ok = ok && !anim.step() && (anim.getFrame() == frames_count);
+        snprintf(what, sizeof(what), "%s stops after the last frame r%u", name, rotation);
+        expect(ok, what);
+
+        anim.rewind();
+        anim.setLoop(true);
+        for (int i = 0; i < 2 * frames_count; i++) {
+            pair.step++;
+            anim.step();
+            pair.reference.drawPageBitmap(x, y, frames_pages + (i % frames_count) * size,
+                                          frames_width, frames_height, SSD1306_WHITE,
+                                          SSD1306_BLACK);
+            if (!pair.finish(fileWriter, stderr, name)) {
+                break;
+            }
+        }
+        if (!pair.report(fileWriter, stderr, name)) {
+            failures++;
+        }
+    }
+}
+
+int main(void)
+{
+    checkDecoder(128, 64);
+    checkDecoder(128, 32);
+    checkSplash("splash1", splash1rle_rle, splash1_pages, splash1_width, splash1_height);
+    checkSplash("splash2", splash2rle_rle, splash2_pages, splash2_width, splash2_height);
+    checkAnimation("anim", anim_anim, 30, 13);
+    checkAnimation("anim --keyframe 5", anim5_anim, -7, 50);
+    return failures ? 1 : 0;
+}
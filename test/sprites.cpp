@@ -0,0 +1,158 @@
+// Host test of Adafruit_SSD1306_Sprites: random adds, removes, moves,
+// image, visibility and z changes, each update() compared with the scene
+// redrawn from scratch with drawPixel(), and the emulated panel compared
+// with the buffer. Run through the Makefile in this directory.
+
+#include "golden_check.h"
+#include <Adafruit_SSD1306_Sprites.h>
+
+#define STEPS 3000    // Random changes per geometry
+#define MAX_SIZE 24   // Largest sprite side, pixels
+#define IMAGES 4      // Images and masks to pick from
+
+static const uint8_t geometries[][2] = { { 128, 64 }, { 128, 32 } };
+
+static uint8_t images[IMAGES][MAX_SIZE * ((MAX_SIZE + 7) / 8)];
+static uint8_t masks[IMAGES][MAX_SIZE * ((MAX_SIZE + 7) / 8)];
+
+/// What the test expects of one sprite id
+typedef struct {
+    bool used;
+    const uint8_t *image;
+    const uint8_t *mask;
+    uint8_t w, h;
+    int16_t x, y;
+    uint8_t z;
+    bool visible;
+} model_t;
+
+static void fileWriter(void *context, const uint8_t *data, size_t len)
+{
+    fwrite(data, 1, len, (FILE *)context);
+}
+
+// Background plus the visible sprites, bottom to top, equal z by id
+static void drawReference(Adafruit_SSD1306 &reference, const uint8_t *background, size_t len,
+                          const model_t *model)
+{
+    memcpy(reference.getBuffer(), background, len);
+    for (uint16_t z = 0; z < 256; z++) {
+        for (uint8_t id = 0; id < SSD1306_SPRITES_MAX; id++) {
+            const model_t *m = &model[id];
+            if (!m->used || !m->visible || (m->z != z)) {
+                continue;
+            }
+            for (int16_t j = 0; j < m->h; j++) {
+                for (int16_t i = 0; i < m->w; i++) {
+                    int16_t k = (j / 8) * m->w + i;
+                    if (m->mask && !((m->mask[k] >> (j & 7)) & 1)) {
+                        continue;
+                    }
+                    reference.drawPixel(m->x + i, m->y + j,
+                                        ((m->image[k] >> (j & 7)) & 1) ? SSD1306_WHITE
+                                                                       : SSD1306_BLACK);
+                }
+            }
+        }
+    }
+}
+
+// Returns false if the sprites and the reference differ at any step
+static bool runSprites(uint8_t w, uint8_t h, uint32_t seed)
+{
+    GoldenPair pair(w, h);
+    Adafruit_SSD1306_Sprites sprites(&pair.display);
+    model_t model[SSD1306_SPRITES_MAX] = {};
+    size_t len = w * ((h + 7) / 8);
+    uint8_t *background = (uint8_t *)malloc(len);
+    int16_t x, y;
+
+    if (!background || !pair.begin()) {
+        fprintf(stderr, "SSD1306 allocation failed\n");
+        free(background);
+        return false;
+    }
+    pair.start(0, seed);
+    memcpy(background, pair.display.getBuffer(), len);
+
+    for (int step = 1; step <= STEPS; step++) {
+        int8_t id = goldenRandom(&seed) % SSD1306_SPRITES_MAX;
+        model_t *m = &model[id];
+        uint32_t r = goldenRandom(&seed);
+
+        if (!m->used) {
+            m->image = images[r % IMAGES];
+            m->mask = (r & 4) ? masks[(r >> 3) % IMAGES] : NULL;
+            m->w = 1 + (r >> 5) % MAX_SIZE;
+            m->h = 1 + (r >> 10) % MAX_SIZE;
+            m->x = (int16_t)((r >> 15) % (w + 2 * MAX_SIZE)) - MAX_SIZE;
+            m->y = (int16_t)((r >> 23) % (h + 2 * MAX_SIZE)) - MAX_SIZE;
+            m->z = (r >> 29) % 3;
+            m->visible = true;
+            int8_t added = sprites.add(m->image, m->mask, m->w, m->h, m->x, m->y, m->z);
+            if (added < 0) {
+                continue;
+            }
+            // Ids come from the lowest free slot, track the one given
+            model[added] = *m;
+            model[added].used = true;
+            if (added != id) {
+                memset(m, 0, sizeof(*m));
+            }
+        }
+        else {
+            switch (r % 6) {
+            case 0:
+                sprites.remove(id);
+                m->used = false;
+                break;
+            case 1:
+            case 2:
+                m->x += (int16_t)((r >> 3) % 21) - 10;
+                m->y += (int16_t)((r >> 8) % 21) - 10;
+                sprites.moveTo(id, m->x, m->y);
+                break;
+            case 3:
+                m->image = images[(r >> 3) % IMAGES];
+                m->mask = (r & 0x40) ? masks[(r >> 7) % IMAGES] : NULL;
+                sprites.setImage(id, m->image, m->mask);
+                break;
+            case 4:
+                m->visible = !m->visible;
+                sprites.setVisible(id, m->visible);
+                break;
+            case 5:
+                m->z = (r >> 3) % 3;
+                sprites.setZ(id, m->z);
+                break;
+            }
+        }
+
+        // Several changes may pile up between updates
+        if (goldenRandom(&seed) & 1) {
+            continue;
+        }
+        sprites.update();
+        drawReference(pair.reference, background, len, model);
+        if (!goldenMatches(pair.display, pair.emulator, pair.reference, &x, &y)) {
+            goldenReport(fileWriter, stderr, "sprites", step, pair.display, false, x, y);
+            free(background);
+            return false;
+        }
+    }
+    goldenReport(fileWriter, stderr, "sprites", -1, pair.display, true, 0, 0);
+    free(background);
+    return true;
+}
+
+int main(void)
+{
+    bool ok = true;
+
+    goldenBitmap(images[0], sizeof(images), 11);
+    goldenBitmap(masks[0], sizeof(masks), 12);
+    for (uint8_t g = 0; g < sizeof(geometries) / sizeof(geometries[0]); g++) {
+        ok &= runSprites(geometries[g][0], geometries[g][1], 1 + g);
+    }
+    return ok ? 0 : 1;
+}
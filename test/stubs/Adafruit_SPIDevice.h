@@ -0,0 +1,8 @@
+// Empty host stand-in for the Adafruit BusIO header of the same name, see
+// test/Makefile. Adafruit_GFX.h includes it for the SPI and I2C display
+// classes of the GFX library, which the host build does not compile.
+
+#ifndef _ADAFRUIT_SPIDEVICE_H_
+#define _ADAFRUIT_SPIDEVICE_H_
+
+#endif // _ADAFRUIT_SPIDEVICE_H_
@@ -0,0 +1,34 @@
+// Host stand-in for the Arduino core header of the same name, see
+// test/Makefile: the PROGMEM accessors, types and helpers that the
+// upstream Adafruit GFX sources and this library use. Flash is plain
+// memory on the host, as it is on the ESP32.
+
+#ifndef _ARDUINO_H_
+#define _ARDUINO_H_
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include "WString.h"
+#include "Print.h"
+
+using std::max;
+using std::min;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define PGM_P const char *
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_float(addr) (*(const float *)(addr))
+#define pgm_read_ptr(addr) (*(void *const *)(addr))
+#define pgm_read_pointer(addr) pgm_read_ptr(addr)
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#endif // _ARDUINO_H_
@@ -0,0 +1,87 @@
+// Host stand-in for the Arduino core header of the same name, see
+// test/Makefile. Numbers are formatted with snprintf().
+
+#ifndef _PRINT_H_
+#define _PRINT_H_
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "WString.h"
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print {
+
+public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size--) {
+            n += write(*buffer++);
+        }
+        return n;
+    }
+    size_t write(const char *s) { return s ? write((const uint8_t *)s, strlen(s)) : 0; }
+
+    size_t print(const char *s) { return write(s); }
+    size_t print(const __FlashStringHelper *s) { return write((const char *)s); }
+    size_t print(const String &s) { return write(s.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(long n, int base = DEC) { return number(n < 0, (n < 0) ? -(unsigned long)n : n, base); }
+    size_t print(unsigned long n, int base = DEC) { return number(false, n, base); }
+    size_t print(int n, int base = DEC) { return print((long)n, base); }
+    size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+    size_t print(unsigned char n, int base = DEC) { return print((unsigned long)n, base); }
+    size_t print(double n, int digits = 2)
+    {
+        char s[32];
+        snprintf(s, sizeof(s), "%.*f", digits, n);
+        return write(s);
+    }
+
+    size_t println(void) { return write("\r\n"); }
+    template <typename T> size_t println(T value) { return print(value) + println(); }
+    template <typename T> size_t println(T value, int format)
+    {
+        return print(value, format) + println();
+    }
+
+    size_t printf(const char *format, ...)
+    {
+        char s[256];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(s, sizeof(s), format, args);
+        va_end(args);
+        return write(s);
+    }
+
+private:
+    size_t number(bool negative, unsigned long n, int base)
+    {
+        char s[8 * sizeof(n) + 2];
+        char *p = &s[sizeof(s) - 1];
+        *p = 0;
+        if (base < 2) {
+            base = DEC;
+        }
+        do {
+            unsigned d = n % base;
+            *--p = (d < 10) ? '0' + d : 'A' + d - 10;
+            n /= base;
+        } while (n);
+        if (negative) {
+            *--p = '-';
+        }
+        return write(p);
+    }
+};
+
+#endif // _PRINT_H_
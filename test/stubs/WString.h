@@ -0,0 +1,36 @@
+// Host stand-in for the Arduino core header of the same name, see
+// test/Makefile: F() strings and the String members Adafruit GFX uses.
+
+#ifndef _WSTRING_H_
+#define _WSTRING_H_
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+
+class String {
+
+public:
+    String(const char *s = "") : buffer(strdup(s ? s : "")) {}
+    String(const String &s) : buffer(strdup(s.buffer)) {}
+    ~String() { free(buffer); }
+
+    String &operator=(const String &s)
+    {
+        if (this != &s) {
+            free(buffer);
+            buffer = strdup(s.buffer);
+        }
+        return *this;
+    }
+    unsigned int length(void) const { return strlen(buffer); }
+    const char *c_str(void) const { return buffer; }
+
+private:
+    char *buffer;
+};
+
+#endif // _WSTRING_H_
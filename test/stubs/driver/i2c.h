@@ -0,0 +1,32 @@
+// Host stand-in for the ESP-IDF header of the same name, see test/Makefile.
+// Transactions are accepted and dropped; tests and benchmarks send the
+// traffic to an Adafruit_SSD1306_Emulator with setTransport() instead.
+
+#ifndef _DRIVER_I2C_H_
+#define _DRIVER_I2C_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+typedef int i2c_port_t;
+typedef void *i2c_cmd_handle_t;
+
+#define I2C_NUM_0 0
+#define I2C_NUM_1 1
+#define I2C_MASTER_WRITE 0
+#define I2C_MASTER_READ 1
+
+i2c_cmd_handle_t i2c_cmd_link_create(void);
+void i2c_cmd_link_delete(i2c_cmd_handle_t cmd);
+esp_err_t i2c_master_start(i2c_cmd_handle_t cmd);
+esp_err_t i2c_master_stop(i2c_cmd_handle_t cmd);
+esp_err_t i2c_master_write_byte(i2c_cmd_handle_t cmd, uint8_t data, bool ack);
+esp_err_t i2c_master_write(i2c_cmd_handle_t cmd, const uint8_t *data, size_t len, bool ack);
+esp_err_t i2c_master_cmd_begin(i2c_port_t port, i2c_cmd_handle_t cmd, TickType_t wait);
+
+#endif // _DRIVER_I2C_H_
@@ -0,0 +1,21 @@
+// Host stand-in for the ESP-IDF header of the same name, see test/Makefile.
+
+#ifndef _ESP_ERR_H_
+#define _ESP_ERR_H_
+
+#include <stdint.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_NO_MEM 0x101
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_STATE 0x103
+#define ESP_ERR_TIMEOUT 0x107
+
+#define ESP_ERROR_CHECK_WITHOUT_ABORT(x) (x)
+
+const char *esp_err_to_name(esp_err_t code);
+
+#endif // _ESP_ERR_H_
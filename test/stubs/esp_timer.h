@@ -0,0 +1,10 @@
+// Host stand-in for the ESP-IDF header of the same name, see test/Makefile.
+
+#ifndef _ESP_TIMER_H_
+#define _ESP_TIMER_H_
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time(void);
+
+#endif // _ESP_TIMER_H_
@@ -0,0 +1,30 @@
+// Host stand-in for the FreeRTOS header of the same name, see test/Makefile.
+
+#ifndef _FREERTOS_H_
+#define _FREERTOS_H_
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFUL
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS (1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms) * configTICK_RATE_HZ / 1000)
+
+// Spinlock stand-in: nesting depth of the only task
+typedef struct {
+    uint32_t count;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZE(mux) ((mux)->count = 0)
+#define portENTER_CRITICAL(mux) ((mux)->count++)
+#define portEXIT_CRITICAL(mux) ((mux)->count--)
+
+#endif // _FREERTOS_H_
@@ -0,0 +1,19 @@
+// Host stand-in for the FreeRTOS header of the same name, see test/Makefile.
+
+#ifndef _FREERTOS_EVENT_GROUPS_H_
+#define _FREERTOS_EVENT_GROUPS_H_
+
+#include "FreeRTOS.h"
+
+typedef void *EventGroupHandle_t;
+typedef uint32_t EventBits_t;
+
+EventGroupHandle_t xEventGroupCreate(void);
+void vEventGroupDelete(EventGroupHandle_t group);
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits);
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits);
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group);
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits,
+                                BaseType_t clear, BaseType_t all, TickType_t wait);
+
+#endif // _FREERTOS_EVENT_GROUPS_H_
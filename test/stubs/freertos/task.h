@@ -0,0 +1,21 @@
+// Host stand-in for the FreeRTOS header of the same name, see test/Makefile.
+// The host build is single-threaded: tasks cannot be created.
+
+#ifndef _FREERTOS_TASK_H_
+#define _FREERTOS_TASK_H_
+
+#include "FreeRTOS.h"
+
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint32_t stack,
+                       void *param, UBaseType_t priority, TaskHandle_t *task);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+
+#endif // _FREERTOS_TASK_H_
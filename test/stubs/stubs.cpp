@@ -0,0 +1,190 @@
+// Host implementations of the ESP-IDF and FreeRTOS stand-ins in this
+// directory, for a single task: mutexes are counters, event groups plain
+// words, and waits return at once.
+
+#include <chrono>
+#include "driver/i2c.h"
+#include "esp_timer.h"
+#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+// ESP-IDF ------------------------------------------------------------------
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    return (code == ESP_OK) ? "ESP_OK" : "ESP_FAIL";
+}
+
+int64_t esp_timer_get_time(void)
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+i2c_cmd_handle_t i2c_cmd_link_create(void)
+{
+    return malloc(1);
+}
+
+void i2c_cmd_link_delete(i2c_cmd_handle_t cmd)
+{
+    free(cmd);
+}
+
+esp_err_t i2c_master_start(i2c_cmd_handle_t cmd)
+{
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_stop(i2c_cmd_handle_t cmd)
+{
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_write_byte(i2c_cmd_handle_t cmd, uint8_t data, bool ack)
+{
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_write(i2c_cmd_handle_t cmd, const uint8_t *data, size_t len, bool ack)
+{
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_cmd_begin(i2c_port_t port, i2c_cmd_handle_t cmd, TickType_t wait)
+{
+    return ESP_OK;
+}
+
+// FreeRTOS -----------------------------------------------------------------
+
+static int currentTask; // Address is the handle of the only task
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint32_t stack,
+                       void *param, UBaseType_t priority, TaskHandle_t *task)
+{
+    return pdFAIL;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(esp_timer_get_time() / 1000 / portTICK_PERIOD_MS);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return &currentTask;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait)
+{
+    return 0;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    return pdPASS;
+}
+
+/// Mutex stand-in: nesting depth of the only task
+typedef struct {
+    uint32_t depth;
+} host_mutex_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return calloc(1, sizeof(host_mutex_t));
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void)
+{
+    return calloc(1, sizeof(host_mutex_t));
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t wait)
+{
+    host_mutex_t *m = (host_mutex_t *)sem;
+    if (m->depth) {
+        return pdFALSE;
+    }
+    m->depth = 1;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    ((host_mutex_t *)sem)->depth = 0;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t wait)
+{
+    ((host_mutex_t *)sem)->depth++;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sem)
+{
+    host_mutex_t *m = (host_mutex_t *)sem;
+    if (!m->depth) {
+        return pdFALSE;
+    }
+    m->depth--;
+    return pdTRUE;
+}
+
+TaskHandle_t xSemaphoreGetMutexHolder(SemaphoreHandle_t sem)
+{
+    return ((host_mutex_t *)sem)->depth ? &currentTask : NULL;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    free(sem);
+}
+
+EventGroupHandle_t xEventGroupCreate(void)
+{
+    return calloc(1, sizeof(EventBits_t));
+}
+
+void vEventGroupDelete(EventGroupHandle_t group)
+{
+    free(group);
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    return *(EventBits_t *)group |= bits;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    EventBits_t old = *(EventBits_t *)group;
+    *(EventBits_t *)group &= ~bits;
+    return old;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group)
+{
+    return *(EventBits_t *)group;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits,
+                                BaseType_t clear, BaseType_t all, TickType_t wait)
+{
+    EventBits_t old = *(EventBits_t *)group;
+    if (clear && (all ? ((old & bits) == bits) : (old & bits))) {
+        *(EventBits_t *)group &= ~bits;
+    }
+    return old;
+}
@@ -0,0 +1,154 @@
+// Host test of Adafruit_SSD1306_TileMap: per-cell dirty tracking of
+// setTile(), fill(), setTileSet() and invalidate(), the bytes update()
+// sends, and random changes compared with the map redrawn from scratch
+// with drawPixel(). Run through the Makefile in this directory.
+
+#include "golden_check.h"
+#include <Adafruit_SSD1306_TileMap.h>
+
+#define TILES 6
+#define STEPS 2000
+
+static const uint8_t PROGMEM tiles[TILES * SSD1306_TILE_SIZE] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // Blank
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // Solid
+    0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, // Box
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, // Diagonal
+    0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, // Checkers
+    0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, // Ring
+};
+
+static int failures;
+
+static void fileWriter(void *context, const uint8_t *data, size_t len)
+{
+    fwrite(data, 1, len, (FILE *)context);
+}
+
+static void expect(bool ok, const char *what)
+{
+    fprintf(stderr, "# check tiles %s: %s\n", what, ok ? "ok" : "FAILED");
+    failures += !ok;
+}
+
+// The map drawn with drawPixel() over the background
+static void drawReference(Adafruit_SSD1306 &reference, const uint8_t *background, size_t len,
+                          Adafruit_SSD1306_TileMap &map, uint8_t cols, uint8_t rows, int16_t x,
+                          uint8_t page)
+{
+    memcpy(reference.getBuffer(), background, len);
+    for (uint8_t row = 0; row < rows; row++) {
+        for (uint8_t col = 0; col < cols; col++) {
+            const uint8_t *tile = tiles + map.getTile(col, row) * SSD1306_TILE_SIZE;
+            for (int16_t i = 0; i < SSD1306_TILE_SIZE; i++) {
+                for (int16_t j = 0; j < 8; j++) {
+                    reference.drawPixel(x + col * SSD1306_TILE_SIZE + i, (page + row) * 8 + j,
+                                        ((pgm_read_byte(&tile[i]) >> j) & 1) ? SSD1306_WHITE
+                                                                             : SSD1306_BLACK);
+                }
+            }
+        }
+    }
+}
+
+// Dirty tracking on a 128x64 display, counted in the bytes sent
+static void checkDirty(void)
+{
+    GoldenPair pair(128, 64);
+    Adafruit_SSD1306_TileMap map(&pair.display, tiles, 16, 8);
+    const ssd1306_emu_counters_t *sent = pair.emulator.getCounters();
+
+    if (!pair.begin()) {
+        expect(false, "allocation");
+        return;
+    }
+    pair.start(0, 1);
+
+    pair.emulator.resetCounters();
+    expect(map.update() && (sent->dataBytes == 128 * 8), "first update sends every cell");
+    pair.emulator.resetCounters();
+    expect(!map.update() && (sent->transactions == 0), "update without changes sends nothing");
+
+    map.setTile(3, 2, 0);
+    expect(!map.update(), "setTile() to the same tile marks nothing");
+
+    pair.emulator.resetCounters();
+    map.setTile(3, 2, 2);
+    expect(map.update() && (sent->dataBytes == SSD1306_TILE_SIZE), "setTile() sends one tile");
+
+    map.setTile(16, 0, 1);
+    map.setTile(0, 8, 1);
+    expect(!map.update() && (map.getTile(16, 0) == 0), "setTile() outside the map is ignored");
+
+    pair.emulator.resetCounters();
+    map.setTile(0, 0, 4);
+    map.setTile(15, 7, 4);
+    expect(map.update() && (sent->dataBytes == 2 * SSD1306_TILE_SIZE), "two cells send two tiles");
+
+    pair.emulator.resetCounters();
+    map.setTile(5, 5, 3);
+    map.setTile(5, 5, map.getTile(4, 4));
+    expect(map.update() && (sent->dataBytes == SSD1306_TILE_SIZE), "a changed-back cell is still sent");
+
+    pair.emulator.resetCounters();
+    map.invalidate();
+    expect(map.update() && (sent->dataBytes == 128 * 8), "invalidate() resends every cell");
+
+    pair.emulator.resetCounters();
+    map.setTileSet(tiles + SSD1306_TILE_SIZE);
+    expect(map.update() && (sent->dataBytes == 128 * 8), "setTileSet() resends every cell");
+
+    map.setTileSet(tiles);
+    map.update();
+    map.fill(1);
+    pair.emulator.resetCounters();
+    expect(map.update() && (sent->dataBytes == 128 * 8), "fill() sends the changed cells");
+    map.fill(1);
+    expect(!map.update(), "fill() with the same tile marks nothing");
+}
+
+// Random changes of a map placed partly off the display
+static void checkRandom(int16_t x, uint8_t page)
+{
+    const uint8_t cols = 12, rows = 5;
+    GoldenPair pair(128, 32);
+    Adafruit_SSD1306_TileMap map(&pair.display, tiles, cols, rows, x, page);
+    size_t len = 128 * 32 / 8;
+    uint8_t background[128 * 32 / 8];
+    uint32_t seed = 7 + x + page;
+    int16_t px, py;
+    char name[32];
+
+    snprintf(name, sizeof(name), "tiles x=%d page=%u", x, page);
+    if (!pair.begin()) {
+        expect(false, "allocation");
+        return;
+    }
+    pair.start(0, seed);
+    memcpy(background, pair.display.getBuffer(), len);
+
+    for (int step = 1; step <= STEPS; step++) {
+        uint32_t r = goldenRandom(&seed);
+        map.setTile(r % (cols + 1), (r >> 8) % (rows + 1), (r >> 16) % TILES);
+        if (r & 0x80000000UL) {
+            continue;
+        }
+        map.update();
+        drawReference(pair.reference, background, len, map, cols, rows, x, page);
+        if (!goldenMatches(pair.display, pair.emulator, pair.reference, &px, &py)) {
+            goldenReport(fileWriter, stderr, name, step, pair.display, false, px, py);
+            failures++;
+            return;
+        }
+    }
+    goldenReport(fileWriter, stderr, name, -1, pair.display, true, 0, 0);
+}
+
+int main(void)
+{
+    checkDirty();
+    checkRandom(0, 0);
+    checkRandom(-13, 1);
+    checkRandom(37, 2);
+    return failures ? 1 : 0;
+}